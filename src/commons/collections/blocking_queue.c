@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <errno.h>
+#include <time.h>
+#include "blocking_queue.h"
+
+#define BLOCKING_QUEUE_WAIT_FOREVER -1
+
+static bool blocking_queue_push_with_timeout(t_blocking_queue *self, void *element, int timeout_ms);
+static bool blocking_queue_pop_with_timeout(t_blocking_queue *self, void **element, int timeout_ms);
+static bool blocking_queue_wait(t_blocking_queue *self, pthread_cond_t *condition, bool(*can_continue)(t_blocking_queue*), int timeout_ms);
+static bool blocking_queue_can_push(t_blocking_queue *self);
+static bool blocking_queue_can_pop(t_blocking_queue *self);
+
+t_blocking_queue *blocking_queue_create(int max_size) {
+	t_blocking_queue *self = malloc(sizeof(t_blocking_queue));
+	self->elements = queue_create_with_capacity(max_size);
+	self->max_size = max_size;
+	self->closed = false;
+
+	pthread_condattr_t attributes;
+	pthread_condattr_init(&attributes);
+	pthread_condattr_setclock(&attributes, CLOCK_MONOTONIC);
+	pthread_mutex_init(&self->mutex, NULL);
+	pthread_cond_init(&self->not_empty, &attributes);
+	pthread_cond_init(&self->not_full, &attributes);
+	pthread_condattr_destroy(&attributes);
+	return self;
+}
+
+bool blocking_queue_push(t_blocking_queue *self, void *element) {
+	return blocking_queue_push_with_timeout(self, element, BLOCKING_QUEUE_WAIT_FOREVER);
+}
+
+bool blocking_queue_try_push(t_blocking_queue *self, void *element) {
+	return blocking_queue_push_with_timeout(self, element, 0);
+}
+
+bool blocking_queue_timed_push(t_blocking_queue *self, void *element, int timeout_ms) {
+	return blocking_queue_push_with_timeout(self, element, timeout_ms);
+}
+
+bool blocking_queue_pop(t_blocking_queue *self, void **element) {
+	return blocking_queue_pop_with_timeout(self, element, BLOCKING_QUEUE_WAIT_FOREVER);
+}
+
+bool blocking_queue_try_pop(t_blocking_queue *self, void **element) {
+	return blocking_queue_pop_with_timeout(self, element, 0);
+}
+
+bool blocking_queue_timed_pop(t_blocking_queue *self, void **element, int timeout_ms) {
+	return blocking_queue_pop_with_timeout(self, element, timeout_ms);
+}
+
+int blocking_queue_drain(t_blocking_queue *self, void **elements, int max_count) {
+	pthread_mutex_lock(&self->mutex);
+	int count = queue_pop_batch(self->elements, elements, max_count);
+	if (count > 0) {
+		pthread_cond_broadcast(&self->not_full);
+	}
+	pthread_mutex_unlock(&self->mutex);
+	return count;
+}
+
+void blocking_queue_close(t_blocking_queue *self) {
+	pthread_mutex_lock(&self->mutex);
+	self->closed = true;
+	pthread_cond_broadcast(&self->not_empty);
+	pthread_cond_broadcast(&self->not_full);
+	pthread_mutex_unlock(&self->mutex);
+}
+
+bool blocking_queue_is_closed(t_blocking_queue *self) {
+	pthread_mutex_lock(&self->mutex);
+	bool closed = self->closed;
+	pthread_mutex_unlock(&self->mutex);
+	return closed;
+}
+
+int blocking_queue_size(t_blocking_queue *self) {
+	pthread_mutex_lock(&self->mutex);
+	int size = queue_size(self->elements);
+	pthread_mutex_unlock(&self->mutex);
+	return size;
+}
+
+void blocking_queue_destroy(t_blocking_queue *self) {
+	blocking_queue_destroy_and_destroy_elements(self, NULL);
+}
+
+void blocking_queue_destroy_and_destroy_elements(t_blocking_queue *self, void(*element_destroyer)(void*)) {
+	queue_destroy_and_destroy_elements(self->elements, element_destroyer);
+	pthread_cond_destroy(&self->not_full);
+	pthread_cond_destroy(&self->not_empty);
+	pthread_mutex_destroy(&self->mutex);
+	free(self);
+}
+
+/********* PRIVATE FUNCTIONS **************/
+
+static bool blocking_queue_push_with_timeout(t_blocking_queue *self, void *element, int timeout_ms) {
+	pthread_mutex_lock(&self->mutex);
+	bool pushed = blocking_queue_wait(self, &self->not_full, blocking_queue_can_push, timeout_ms) && !self->closed;
+	if (pushed) {
+		queue_push(self->elements, element);
+		pthread_cond_signal(&self->not_empty);
+	}
+	pthread_mutex_unlock(&self->mutex);
+	return pushed;
+}
+
+static bool blocking_queue_pop_with_timeout(t_blocking_queue *self, void **element, int timeout_ms) {
+	pthread_mutex_lock(&self->mutex);
+	bool popped = blocking_queue_wait(self, &self->not_empty, blocking_queue_can_pop, timeout_ms) && !queue_is_empty(self->elements);
+	if (popped) {
+		*element = queue_pop(self->elements);
+		pthread_cond_signal(&self->not_full);
+	}
+	pthread_mutex_unlock(&self->mutex);
+	return popped;
+}
+
+static bool blocking_queue_wait(t_blocking_queue *self, pthread_cond_t *condition, bool(*can_continue)(t_blocking_queue*), int timeout_ms) {
+	if (timeout_ms == BLOCKING_QUEUE_WAIT_FOREVER) {
+		while (!can_continue(self)) {
+			pthread_cond_wait(condition, &self->mutex);
+		}
+		return true;
+	}
+
+	struct timespec deadline;
+	clock_gettime(CLOCK_MONOTONIC, &deadline);
+	deadline.tv_sec += timeout_ms / 1000;
+	deadline.tv_nsec += (timeout_ms % 1000) * 1000000L;
+	if (deadline.tv_nsec >= 1000000000L) {
+		deadline.tv_sec++;
+		deadline.tv_nsec -= 1000000000L;
+	}
+
+	while (!can_continue(self)) {
+		if (timeout_ms == 0 || pthread_cond_timedwait(condition, &self->mutex, &deadline) == ETIMEDOUT) {
+			return can_continue(self);
+		}
+	}
+	return true;
+}
+
+static bool blocking_queue_can_push(t_blocking_queue *self) {
+	return self->closed || queue_size(self->elements) < self->max_size;
+}
+
+static bool blocking_queue_can_pop(t_blocking_queue *self) {
+	return self->closed || !queue_is_empty(self->elements);
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BLOCKING_QUEUE_H_
+#define BLOCKING_QUEUE_H_
+
+	#include <pthread.h>
+	#include <stdbool.h>
+	#include "queue.h"
+
+	/**
+	 * @file
+	 * @brief `#include <commons/collections/blocking_queue.h>`
+	 *
+	 * Cola de capacidad limitada que puede ser usada por varios hilos
+	 * productores y consumidores a la vez. Reemplaza la combinación de un
+	 * `t_queue` con un mutex y semáforos para contar elementos y lugares libres.
+	 */
+
+	/**
+	 * @struct t_blocking_queue
+	 * @brief Cola bloqueante. Inicializar con `blocking_queue_create()`
+	 */
+	typedef struct {
+		t_queue *elements;
+		int max_size;
+		bool closed;
+		pthread_mutex_t mutex;
+		pthread_cond_t not_empty;
+		pthread_cond_t not_full;
+	} t_blocking_queue;
+
+	/**
+	 * @brief Crea una cola bloqueante
+	 * @param max_size: Cantidad máxima de elementos en espera. Al alcanzarla,
+	 *                  los productores se bloquean hasta que haya lugar.
+	 * @return Retorna un puntero a la cola creada, liberable con:
+	 *         - `blocking_queue_destroy()` si se quiere liberar la cola pero no
+	 *           los elementos que contiene.
+	 *         - `blocking_queue_destroy_and_destroy_elements()` si se quiere
+	 *           liberar la cola con los elementos que contiene.
+	 *
+	 * Ejemplo de uso:
+	 * @code
+	 * // Productor
+	 * while ((request = receive_request(socket)) != NULL) {
+	 *     blocking_queue_push(requests, request);
+	 * }
+	 * blocking_queue_close(requests);
+	 *
+	 * // Consumidores
+	 * t_request* request;
+	 * while (blocking_queue_pop(requests, (void**) &request)) {
+	 *     handle_request(request);
+	 * }
+	 * @endcode
+	 */
+	t_blocking_queue *blocking_queue_create(int max_size);
+
+	/**
+	 * @brief Agrega un elemento al final de la cola, esperando a que haya
+	 *        lugar si está llena.
+	 * @return false si la cola fue cerrada, en cuyo caso el elemento no se
+	 *         agrega y sigue perteneciendo a quien lo quiso agregar.
+	 */
+	bool blocking_queue_push(t_blocking_queue *, void *element);
+
+	/**
+	 * @brief Igual que `blocking_queue_push()`, pero sin esperar.
+	 * @return false si la cola está llena o cerrada.
+	 */
+	bool blocking_queue_try_push(t_blocking_queue *, void *element);
+
+	/**
+	 * @brief Igual que `blocking_queue_push()`, pero esperando a lo sumo
+	 *        `timeout_ms` milisegundos.
+	 * @return false si la cola sigue llena al vencer el plazo o está cerrada.
+	 */
+	bool blocking_queue_timed_push(t_blocking_queue *, void *element, int timeout_ms);
+
+	/**
+	 * @brief Quita el primer elemento de la cola, esperando a que haya alguno
+	 *        si está vacía.
+	 * @param[out] element Donde se guarda el elemento extraído, que pasa a
+	 *                     pertenecer a quien lo extrajo.
+	 * @return false si la cola fue cerrada y ya no quedan elementos.
+	 *
+	 * @note Cerrar la cola no descarta los elementos en espera: los
+	 *       consumidores los siguen recibiendo hasta vaciarla.
+	 */
+	bool blocking_queue_pop(t_blocking_queue *, void **element);
+
+	/**
+	 * @brief Igual que `blocking_queue_pop()`, pero sin esperar.
+	 * @return false si la cola está vacía.
+	 */
+	bool blocking_queue_try_pop(t_blocking_queue *, void **element);
+
+	/**
+	 * @brief Igual que `blocking_queue_pop()`, pero esperando a lo sumo
+	 *        `timeout_ms` milisegundos.
+	 * @return false si la cola sigue vacía al vencer el plazo.
+	 */
+	bool blocking_queue_timed_pop(t_blocking_queue *, void **element, int timeout_ms);
+
+	/**
+	 * @brief Quita, sin esperar, hasta `max_count` elementos de la cola.
+	 * @param[out] elements Arreglo con lugar para al menos `max_count` elementos.
+	 * @return La cantidad de elementos extraídos.
+	 */
+	int blocking_queue_drain(t_blocking_queue *, void **elements, int max_count);
+
+	/**
+	 * @brief Cierra la cola: a partir de ese momento no se aceptan nuevos
+	 *        elementos y se despierta a todos los hilos que estaban esperando.
+	 */
+	void blocking_queue_close(t_blocking_queue *);
+
+	/**
+	 * @brief Retorna true si la cola fue cerrada
+	 */
+	bool blocking_queue_is_closed(t_blocking_queue *);
+
+	/**
+	 * @brief Retorna la cantidad de elementos en espera
+	 */
+	int blocking_queue_size(t_blocking_queue *);
+
+	/**
+	 * @brief Destruye la cola sin liberar los elementos que contiene
+	 * @warning Ningún hilo debe estar usando la cola al destruirla.
+	 */
+	void blocking_queue_destroy(t_blocking_queue *);
+
+	/**
+	 * @brief Destruye la cola, liberando los elementos que contiene con
+	 *        `element_destroyer`
+	 * @warning Ningún hilo debe estar usando la cola al destruirla.
+	 */
+	void blocking_queue_destroy_and_destroy_elements(t_blocking_queue *, void(*element_destroyer)(void*));
+
+#endif /* BLOCKING_QUEUE_H_ */
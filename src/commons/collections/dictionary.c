@@ -23,110 +23,201 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
+#include <sys/random.h>
 #include "dictionary.h"
 
-static unsigned int dictionary_hash(char *key, int key_len);
+#include <stdint.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#define DICTIONARY_GROUP_WIDTH 16
+#define DICTIONARY_REHASH_STEP 16
+#define DICTIONARY_CONTROL_EMPTY ((int8_t) 0)
+#define DICTIONARY_CONTROL_DELETED ((int8_t) 1)
+#define DICTIONARY_CONTROL_FULL(hash) ((int8_t) (0x80 | ((hash) & 0x7F)))
+
+static unsigned int dictionary_hash(t_dictionary *self, char *key, size_t key_len);
+static uint64_t dictionary_hash_mix(uint64_t a, uint64_t b);
+static uint64_t dictionary_hash_read(char *bytes, int size);
+static uint64_t dictionary_random_seed(void);
+static t_dictionary *dictionary_create_internal(int capacity, uint64_t seed);
 static void dictionary_resize(t_dictionary *, int new_max_size);
-
-static t_hash_element *dictionary_create_element(char *key, unsigned int key_hash, void *data);
-static t_hash_element *dictionary_get_element(t_dictionary *self, char *key);
-static void *dictionary_remove_element(t_dictionary *self, char *key);
-static void dictionary_destroy_element(t_dictionary *self, t_hash_element *element, void(*data_destroyer)(void*));
+static void dictionary_rehash_step(t_dictionary *self, int max_slots);
+static t_hash_table *dictionary_find(t_dictionary *self, char *key, size_t key_len, unsigned int key_hash, int *index);
+static t_hash_slot *dictionary_insert(t_dictionary *self, char *key, unsigned int key_hash, void *data);
+static char *dictionary_key_copy(char *key, size_t key_len);
 static void internal_dictionary_clean_and_destroy_elements(t_dictionary *self, void(*data_destroyer)(void*));
 
+static void dictionary_table_create(t_hash_table *table, int max_size);
+static void dictionary_table_destroy(t_hash_table *table);
+static int dictionary_table_max_load(t_hash_table *table, double max_load_factor);
+static int dictionary_table_size_for(int capacity, double max_load_factor);
+static int dictionary_table_find_index(t_hash_table *table, char *key, size_t key_len, unsigned int key_hash);
+static int dictionary_table_find_available_index(t_hash_table *table, unsigned int key_hash);
+static void dictionary_table_insert_in_index(t_hash_table *table, int index, char *key, unsigned int key_hash, void *data);
+static void dictionary_table_remove_index(t_hash_table *table, int index);
+static void dictionary_table_iterate(t_hash_table *table, void(*closure)(t_hash_slot*));
+static uint16_t dictionary_match_control(int8_t *group, int8_t control);
+static uint16_t dictionary_match_available(int8_t *group);
+static bool dictionary_is_full(int8_t control);
+
 t_dictionary *dictionary_create() {
+	return dictionary_create_with_capacity(DEFAULT_DICTIONARY_INITIAL_SIZE);
+}
+
+t_dictionary *dictionary_create_with_capacity(int capacity) {
+	return dictionary_create_internal(capacity, dictionary_random_seed());
+}
+
+t_dictionary *dictionary_create_with_seed(uint64_t seed) {
+	return dictionary_create_internal(DEFAULT_DICTIONARY_INITIAL_SIZE, seed);
+}
+
+static t_dictionary *dictionary_create_internal(int capacity, uint64_t seed) {
 	t_dictionary *self = malloc(sizeof(t_dictionary));
-	self->table_max_size = DEFAULT_DICTIONARY_INITIAL_SIZE;
-	self->elements = calloc(self->table_max_size, sizeof(t_hash_element*));
-	self->table_current_size = 0;
-	self->elements_amount = 0;
+	self->seed = seed;
+	self->max_load_factor = DEFAULT_DICTIONARY_MAX_LOAD_FACTOR;
+	dictionary_table_create(&self->table, dictionary_table_size_for(capacity, self->max_load_factor));
+	self->previous_table = (t_hash_table) { .elements = NULL, .control = NULL };
+	self->rehash_index = 0;
+	self->incremental_resize = false;
 	return self;
 }
 
-static unsigned int dictionary_hash(char *key, int key_len) {
-	unsigned int hash = 0;
-	int index;
+void dictionary_set_max_load_factor(t_dictionary *self, double max_load_factor) {
+	if (max_load_factor > 0 && max_load_factor <= 1) {
+		self->max_load_factor = max_load_factor;
+	}
+}
 
-	for (index = 0; index < key_len; index++) {
-		unsigned char c = key[index];
-		hash += c;
-		hash += (hash << 10);
-		hash ^= (hash >> 6);
+void dictionary_reserve(t_dictionary *self, int capacity) {
+	int table_max_size = dictionary_table_size_for(capacity, self->max_load_factor);
+	if (table_max_size > self->table.table_max_size) {
+		dictionary_resize(self, table_max_size);
 	}
-	hash += (hash << 3);
-	hash ^= (hash >> 11);
-	hash += (hash << 15);
+}
 
-	return hash;
+void dictionary_set_incremental_resize(t_dictionary *self, bool enabled) {
+	if (!enabled) {
+		dictionary_rehash_step(self, -1);
+	}
+	self->incremental_resize = enabled;
 }
 
 void dictionary_put(t_dictionary *self, char *key, void *data) {
-	t_hash_element *existing_element = dictionary_get_element(self, key);
+	dictionary_put_with_length(self, key, strlen(key), data);
+}
+
+void dictionary_put_with_length(t_dictionary *self, char *key, size_t key_len, void *data) {
+	dictionary_rehash_step(self, DICTIONARY_REHASH_STEP);
 
-	if(existing_element != NULL) {
-		existing_element->data = data;
+	int index;
+	unsigned int key_hash = dictionary_hash(self, key, key_len);
+	t_hash_table *table = dictionary_find(self, key, key_len, key_hash, &index);
+	if (table != NULL) {
+		table->elements[index].data = data;
 		return;
 	}
 
-	unsigned int key_hash = dictionary_hash(key, strlen(key));
-	int index = key_hash % self->table_max_size;
-	t_hash_element * new_element = dictionary_create_element(strdup(key), key_hash, data);
+	dictionary_insert(self, dictionary_key_copy(key, key_len), key_hash, data);
+}
 
-	t_hash_element *element = self->elements[index];
+void *dictionary_get(t_dictionary *self, char *key) {
+	return dictionary_get_with_length(self, key, strlen(key));
+}
 
-	if (element == NULL) {
-		self->elements[index] = new_element;
-		self->table_current_size++;
+void *dictionary_get_with_length(t_dictionary *self, char *key, size_t key_len) {
+	dictionary_rehash_step(self, DICTIONARY_REHASH_STEP);
 
-		if (self->table_current_size >= self->table_max_size) {
-			dictionary_resize(self, self->table_max_size * 2);
-		}
+	int index;
+	t_hash_table *table = dictionary_find(self, key, key_len, dictionary_hash(self, key, key_len), &index);
+	return table != NULL ? table->elements[index].data : NULL;
+}
 
-	} else {
+void **dictionary_get_or_insert(t_dictionary *self, char *key, void*(*factory)(char*)) {
+	return dictionary_get_or_insert_with_length(self, key, strlen(key), factory);
+}
 
-		while (element->next != NULL) {
-			element = element->next;
-		}
+void **dictionary_get_or_insert_with_length(t_dictionary *self, char *key, size_t key_len, void*(*factory)(char*)) {
+	dictionary_rehash_step(self, DICTIONARY_REHASH_STEP);
 
-		element->next = new_element;
+	int index;
+	unsigned int key_hash = dictionary_hash(self, key, key_len);
+	t_hash_table *table = dictionary_find(self, key, key_len, key_hash, &index);
+	if (table != NULL) {
+		return &table->elements[index].data;
 	}
 
-	self->elements_amount++;
+	t_hash_slot *slot = dictionary_insert(self, dictionary_key_copy(key, key_len), key_hash, NULL);
+	slot->data = factory != NULL ? factory(slot->key) : NULL;
+	return &slot->data;
 }
 
-void *dictionary_get(t_dictionary *self, char *key) {
-	t_hash_element *element = dictionary_get_element(self, key);
-	return element != NULL ? element->data : NULL;
+void *dictionary_compute(t_dictionary *self, char *key, void*(*remapping)(char*, void*)) {
+	return dictionary_compute_with_length(self, key, strlen(key), remapping);
+}
+
+void *dictionary_compute_with_length(t_dictionary *self, char *key, size_t key_len, void*(*remapping)(char*, void*)) {
+	dictionary_rehash_step(self, DICTIONARY_REHASH_STEP);
+
+	int index;
+	unsigned int key_hash = dictionary_hash(self, key, key_len);
+	t_hash_table *table = dictionary_find(self, key, key_len, key_hash, &index);
+	if (table != NULL) {
+		t_hash_slot *slot = &table->elements[index];
+		slot->data = remapping(slot->key, slot->data);
+		if (slot->data == NULL) {
+			free(slot->key);
+			dictionary_table_remove_index(table, index);
+			return NULL;
+		}
+		return slot->data;
+	}
+
+	char *key_copy = dictionary_key_copy(key, key_len);
+	void *data = remapping(key_copy, NULL);
+	if (data == NULL) {
+		free(key_copy);
+		return NULL;
+	}
+	dictionary_insert(self, key_copy, key_hash, data);
+	return data;
 }
 
 void *dictionary_remove(t_dictionary *self, char *key) {
-	void *data = dictionary_remove_element(self, key);
-	if( data != NULL){
-		self->elements_amount--;
+	dictionary_rehash_step(self, DICTIONARY_REHASH_STEP);
+
+	int index;
+	size_t key_len = strlen(key);
+	t_hash_table *table = dictionary_find(self, key, key_len, dictionary_hash(self, key, key_len), &index);
+	if (table == NULL) {
+		return NULL;
 	}
+
+	void *data = table->elements[index].data;
+	free(table->elements[index].key);
+	dictionary_table_remove_index(table, index);
 	return data;
 }
 
 void dictionary_remove_and_destroy(t_dictionary *self, char *key, void(*data_destroyer)(void*)) {
-	void *data = dictionary_remove_element(self, key);
+	void *data = dictionary_remove(self, key);
 
 	if( data != NULL){
-		self->elements_amount--;
 		data_destroyer(data);
 	}
 }
 
 void dictionary_iterator(t_dictionary *self, void(*closure)(char*,void*)) {
-	int table_index;
-	for (table_index = 0; table_index < self->table_max_size; table_index++) {
-		t_hash_element *element = self->elements[table_index];
-
-		while (element != NULL) {
-			closure(element->key, element->data);
-			element = element->next;
-
-		}
+	void _apply_closure(t_hash_slot *slot) {
+		closure(slot->key, slot->data);
+	}
+	if (self->previous_table.elements != NULL) {
+		dictionary_table_iterate(&self->previous_table, _apply_closure);
 	}
+	dictionary_table_iterate(&self->table, _apply_closure);
 }
 
 void dictionary_clean(t_dictionary *self) {
@@ -160,165 +251,346 @@ void dictionary_clean_and_destroy_elements(t_dictionary *self, void(*data_destro
 }
 
 bool dictionary_has_key(t_dictionary *self, char* key) {
-	return dictionary_get_element(self, key) != NULL;
+	int index;
+	size_t key_len = strlen(key);
+	return dictionary_find(self, key, key_len, dictionary_hash(self, key, key_len), &index) != NULL;
 }
 
 bool dictionary_is_empty(t_dictionary *self) {
-	return self->elements_amount == 0;
+	return dictionary_size(self) == 0;
 }
 
 int dictionary_size(t_dictionary *self) {
-	return self->elements_amount;
+	int size = self->table.elements_amount;
+	if (self->previous_table.elements != NULL) {
+		size += self->previous_table.elements_amount;
+	}
+	return size;
 }
 
 void dictionary_destroy(t_dictionary *self) {
 	dictionary_clean(self);
-	free(self->elements);
+	dictionary_table_destroy(&self->table);
 	free(self);
 }
 
 void dictionary_destroy_and_destroy_elements(t_dictionary *self, void(*data_destroyer)(void*)) {
 	dictionary_clean_and_destroy_elements(self, data_destroyer);
-	free(self->elements);
+	dictionary_table_destroy(&self->table);
 	free(self);
 }
 
 static void dictionary_resize(t_dictionary *self, int new_max_size) {
-	t_hash_element **new_table = calloc(new_max_size, sizeof(t_hash_element*));
-	t_hash_element **old_table = self->elements;
+	dictionary_rehash_step(self, -1);
 
-	self->table_current_size = 0;
+	self->previous_table = self->table;
+	self->rehash_index = 0;
+	dictionary_table_create(&self->table, new_max_size);
 
-	int table_index;
-	for (table_index = 0; table_index < self->table_max_size; table_index++) {
-		t_hash_element *old_element = old_table[table_index];
-		t_hash_element *next_element;
+	if (!self->incremental_resize) {
+		dictionary_rehash_step(self, -1);
+	}
+}
 
-		while( old_element != NULL) {
-			// new position
-			int new_index = old_element->hashcode % new_max_size;
-			t_hash_element *new_element = new_table[new_index];
+static void dictionary_rehash_step(t_dictionary *self, int max_slots) {
+	t_hash_table *previous = &self->previous_table;
+	if (previous->elements == NULL) {
+		return;
+	}
 
-			if (new_element == NULL) {
-				new_table[new_index] = old_element;
-				self->table_current_size++;
-			} else {
+	int last_index = max_slots < 0 ? previous->table_max_size : self->rehash_index + max_slots;
+	if (last_index > previous->table_max_size) {
+		last_index = previous->table_max_size;
+	}
 
-				while (new_element->next != NULL) {
-					new_element = new_element->next;
-				}
+	for (; self->rehash_index < last_index; self->rehash_index++) {
+		if (dictionary_is_full(previous->control[self->rehash_index])) {
+			t_hash_slot *slot = &previous->elements[self->rehash_index];
+			int new_index = dictionary_table_find_available_index(&self->table, slot->hashcode);
+			dictionary_table_insert_in_index(&self->table, new_index, slot->key, slot->hashcode, slot->data);
+			previous->control[self->rehash_index] = DICTIONARY_CONTROL_DELETED;
+			previous->elements_amount--;
+		}
+	}
 
-				new_element->next = old_element;
-			}
+	if (self->rehash_index == previous->table_max_size) {
+		dictionary_table_destroy(previous);
+	}
+}
 
-			next_element = old_element->next;
-			old_element->next = NULL;
-			old_element = next_element;
+static t_hash_table *dictionary_find(t_dictionary *self, char *key, size_t key_len, unsigned int key_hash, int *index) {
+	*index = dictionary_table_find_index(&self->table, key, key_len, key_hash);
+	if (*index != -1) {
+		return &self->table;
+	}
+
+	if (self->previous_table.elements != NULL) {
+		*index = dictionary_table_find_index(&self->previous_table, key, key_len, key_hash);
+		if (*index != -1) {
+			return &self->previous_table;
 		}
 	}
 
-	self->elements = new_table;
-	self->table_max_size = new_max_size;
-	free(old_table);
+	return NULL;
 }
 
-static void internal_dictionary_clean_and_destroy_elements(t_dictionary *self, void(*data_destroyer)(void*)) {
-	int table_index;
-
-	for (table_index = 0; table_index < self->table_max_size; table_index++) {
-		t_hash_element *element = self->elements[table_index];
-		t_hash_element *next_element = NULL;
+static t_hash_slot *dictionary_insert(t_dictionary *self, char *key, unsigned int key_hash, void *data) {
+	t_hash_table *table = &self->table;
+	int index = dictionary_table_find_available_index(table, key_hash);
 
-		while (element != NULL) {
+	int max_load = dictionary_table_max_load(table, self->max_load_factor);
+	if (table->control[index] == DICTIONARY_CONTROL_EMPTY && table->table_current_size >= max_load) {
+		bool mostly_deleted = dictionary_size(self) < max_load / 2;
+		dictionary_resize(self, mostly_deleted ? table->table_max_size : table->table_max_size * 2);
+		index = dictionary_table_find_available_index(table, key_hash);
+	}
 
-			next_element = element->next;
+	dictionary_table_insert_in_index(table, index, key, key_hash, data);
+	return &table->elements[index];
+}
 
-			dictionary_destroy_element(self, element, data_destroyer);
+static char *dictionary_key_copy(char *key, size_t key_len) {
+	char *copy = malloc(key_len + 1);
+	memcpy(copy, key, key_len);
+	copy[key_len] = '\0';
+	return copy;
+}
 
-			element = next_element;
+static void internal_dictionary_clean_and_destroy_elements(t_dictionary *self, void(*data_destroyer)(void*)) {
+	void _destroy_slot(t_hash_slot *slot) {
+		if (data_destroyer != NULL) {
+			data_destroyer(slot->data);
 		}
+		free(slot->key);
+	}
 
-		self->elements[table_index] = NULL;
+	if (self->previous_table.elements != NULL) {
+		dictionary_table_iterate(&self->previous_table, _destroy_slot);
+		dictionary_table_destroy(&self->previous_table);
 	}
 
-	self->table_current_size = 0;
-	self->elements_amount = 0;
+	dictionary_table_iterate(&self->table, _destroy_slot);
+	memset(self->table.control, DICTIONARY_CONTROL_EMPTY, self->table.table_max_size * sizeof(int8_t));
+	self->table.table_current_size = 0;
+	self->table.elements_amount = 0;
 }
 
-static t_hash_element *dictionary_create_element(char *key, unsigned int key_hash, void *data) {
-	t_hash_element *element = malloc(sizeof(t_hash_element));
+/********* HASH FUNCTION **************/
+
+// Constantes de wyhash (dominio público), de donde se toma el esquema de
+// mezcla: cada palabra de 64 bits se multiplica contra la semilla y se
+// combinan ambas mitades del producto de 128 bits.
+static const uint64_t dictionary_hash_secret[4] = {
+	0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull
+};
+
+static unsigned int dictionary_hash(t_dictionary *self, char *key, size_t key_len) {
+	const uint64_t *secret = dictionary_hash_secret;
+	uint64_t seed = self->seed ^ dictionary_hash_mix(self->seed ^ secret[0], secret[1]);
+	uint64_t a, b;
+
+	if (key_len <= 16) {
+		if (key_len >= 4) {
+			size_t middle = (key_len >> 3) << 2;
+			a = (dictionary_hash_read(key, 4) << 32) | dictionary_hash_read(key + middle, 4);
+			b = (dictionary_hash_read(key + key_len - 4, 4) << 32) | dictionary_hash_read(key + key_len - 4 - middle, 4);
+		} else if (key_len > 0) {
+			unsigned char *bytes = (unsigned char*) key;
+			a = ((uint64_t) bytes[0] << 16) | ((uint64_t) bytes[key_len >> 1] << 8) | bytes[key_len - 1];
+			b = 0;
+		} else {
+			a = b = 0;
+		}
+	} else {
+		size_t remaining = key_len;
+		if (remaining >= 48) {
+			uint64_t seed1 = seed, seed2 = seed;
+			do {
+				seed  = dictionary_hash_mix(dictionary_hash_read(key, 8) ^ secret[1], dictionary_hash_read(key + 8, 8) ^ seed);
+				seed1 = dictionary_hash_mix(dictionary_hash_read(key + 16, 8) ^ secret[2], dictionary_hash_read(key + 24, 8) ^ seed1);
+				seed2 = dictionary_hash_mix(dictionary_hash_read(key + 32, 8) ^ secret[3], dictionary_hash_read(key + 40, 8) ^ seed2);
+				key += 48;
+				remaining -= 48;
+			} while (remaining >= 48);
+			seed ^= seed1 ^ seed2;
+		}
+		while (remaining > 16) {
+			seed = dictionary_hash_mix(dictionary_hash_read(key, 8) ^ secret[1], dictionary_hash_read(key + 8, 8) ^ seed);
+			key += 16;
+			remaining -= 16;
+		}
+		a = dictionary_hash_read(key + remaining - 16, 8);
+		b = dictionary_hash_read(key + remaining - 8, 8);
+	}
+
+	__uint128_t product = (__uint128_t) (a ^ secret[1]) * (b ^ seed);
+	a = (uint64_t) product;
+	b = (uint64_t) (product >> 64);
+	return (unsigned int) dictionary_hash_mix(a ^ secret[0] ^ key_len, b ^ secret[1]);
+}
 
-	element->key = key;
-	element->data = data;
-	element->hashcode = key_hash;
-	element->next = NULL;
+static uint64_t dictionary_hash_mix(uint64_t a, uint64_t b) {
+	__uint128_t product = (__uint128_t) a * b;
+	return (uint64_t) product ^ (uint64_t) (product >> 64);
+}
 
-	return element;
+static uint64_t dictionary_hash_read(char *bytes, int size) {
+	if (size == 4) {
+		uint32_t word;
+		memcpy(&word, bytes, sizeof(word));
+		return word;
+	}
+	uint64_t word;
+	memcpy(&word, bytes, sizeof(word));
+	return word;
 }
 
-static t_hash_element *dictionary_get_element(t_dictionary *self, char *key) {
-	unsigned int key_hash = dictionary_hash(key, strlen(key));
-	int index = key_hash % self->table_max_size;
+static uint64_t dictionary_random_seed() {
+	uint64_t seed;
+	if (getrandom(&seed, sizeof(seed), GRND_NONBLOCK) != sizeof(seed)) {
+		struct timespec now;
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		seed = dictionary_hash_mix(now.tv_sec ^ dictionary_hash_secret[2], now.tv_nsec ^ (uintptr_t) &seed);
+	}
+	return seed;
+}
 
-	t_hash_element *element = self->elements[index];
+/********* HASH TABLE **************/
 
-	if (element == NULL) {
-		return NULL;
+static void dictionary_table_create(t_hash_table *table, int max_size) {
+	int table_max_size = DICTIONARY_GROUP_WIDTH;
+	while (table_max_size < max_size) {
+		table_max_size *= 2;
 	}
 
-	do {
+	table->table_max_size = table_max_size;
+	table->table_current_size = 0;
+	table->elements_amount = 0;
+	table->control = calloc(table_max_size, sizeof(int8_t));
+	table->elements = malloc(table_max_size * sizeof(t_hash_slot));
+}
 
-		if (element->hashcode == key_hash) {
-			return element;
-		}
+static void dictionary_table_destroy(t_hash_table *table) {
+	free(table->control);
+	free(table->elements);
+	table->control = NULL;
+	table->elements = NULL;
+}
 
-	} while ((element = element->next) != NULL);
+static int dictionary_table_max_load(t_hash_table *table, double max_load_factor) {
+	// Siempre queda al menos una posición libre para que las búsquedas terminen
+	int max_load = table->table_max_size * max_load_factor;
+	return max_load < table->table_max_size ? max_load : table->table_max_size - 1;
+}
 
-	return NULL;
+static int dictionary_table_size_for(int capacity, double max_load_factor) {
+	t_hash_table table = { .table_max_size = DICTIONARY_GROUP_WIDTH };
+	while (dictionary_table_max_load(&table, max_load_factor) < capacity) {
+		table.table_max_size *= 2;
+	}
+	return table.table_max_size;
 }
 
-static void *dictionary_remove_element(t_dictionary *self, char *key) {
-	unsigned int key_hash = dictionary_hash(key, strlen(key));
-	int index = key_hash % self->table_max_size;
+static int dictionary_table_find_index(t_hash_table *table, char *key, size_t key_len, unsigned int key_hash) {
+	int groups_mask = table->table_max_size / DICTIONARY_GROUP_WIDTH - 1;
+	int group = (key_hash >> 7) & groups_mask;
 
-	t_hash_element *element = self->elements[index];
+	for (int step = 1; step <= groups_mask + 1; step++) {
+		int8_t *control = table->control + group * DICTIONARY_GROUP_WIDTH;
 
-	if (element == NULL) {
-		return NULL;
-	}
+		uint16_t matches = dictionary_match_control(control, DICTIONARY_CONTROL_FULL(key_hash));
+		while (matches != 0) {
+			int index = group * DICTIONARY_GROUP_WIDTH + __builtin_ctz(matches);
+			t_hash_slot *slot = &table->elements[index];
+			if (slot->hashcode == key_hash && strncmp(slot->key, key, key_len) == 0 && slot->key[key_len] == '\0') {
+				return index;
+			}
+			matches &= matches - 1;
+		}
 
-	if (element->hashcode == key_hash) {
-		void *data = element->data;
-		self->elements[index] = element->next;
-		if (self->elements[index] == NULL) {
-			self->table_current_size--;
+		if (dictionary_match_control(control, DICTIONARY_CONTROL_EMPTY) != 0) {
+			return -1;
 		}
-		free(element->key);
-		free(element);
-		return data;
+		group = (group + step) & groups_mask;
 	}
 
-	while (element->next != NULL) {
+	return -1;
+}
+
+static int dictionary_table_find_available_index(t_hash_table *table, unsigned int key_hash) {
+	int groups_mask = table->table_max_size / DICTIONARY_GROUP_WIDTH - 1;
+	int group = (key_hash >> 7) & groups_mask;
 
-		if (element->next->hashcode == key_hash) {
-			void *data = element->next->data;
-			t_hash_element *aux = element->next;
-			element->next = element->next->next;
-			free(aux->key);
-			free(aux);
-			return data;
+	for (int step = 1; ; step++) {
+		uint16_t available = dictionary_match_available(table->control + group * DICTIONARY_GROUP_WIDTH);
+		if (available != 0) {
+			return group * DICTIONARY_GROUP_WIDTH + __builtin_ctz(available);
 		}
+		group = (group + step) & groups_mask;
+	}
+}
 
-		element = element->next;
+static void dictionary_table_insert_in_index(t_hash_table *table, int index, char *key, unsigned int key_hash, void *data) {
+	if (table->control[index] == DICTIONARY_CONTROL_EMPTY) {
+		table->table_current_size++;
 	}
+	table->control[index] = DICTIONARY_CONTROL_FULL(key_hash);
+	table->elements[index] = (t_hash_slot) { .key = key, .hashcode = key_hash, .data = data };
+	table->elements_amount++;
+}
 
-	return NULL;
+static void dictionary_table_remove_index(t_hash_table *table, int index) {
+	// Si el grupo tiene lugares vacíos ninguna búsqueda pasó de largo por él,
+	// por lo que no hace falta dejar una marca de borrado.
+	int8_t *group = table->control + index / DICTIONARY_GROUP_WIDTH * DICTIONARY_GROUP_WIDTH;
+	if (dictionary_match_control(group, DICTIONARY_CONTROL_EMPTY) != 0) {
+		table->control[index] = DICTIONARY_CONTROL_EMPTY;
+		table->table_current_size--;
+	} else {
+		table->control[index] = DICTIONARY_CONTROL_DELETED;
+	}
+	table->elements_amount--;
+}
+
+static void dictionary_table_iterate(t_hash_table *table, void(*closure)(t_hash_slot*)) {
+	int table_index;
+	for (table_index = 0; table_index < table->table_max_size; table_index++) {
+		if (dictionary_is_full(table->control[table_index])) {
+			closure(&table->elements[table_index]);
+		}
+	}
 }
 
-static void dictionary_destroy_element(t_dictionary *self, t_hash_element *element, void(*data_destroyer)(void*)) {
-	if (data_destroyer != NULL) {
-		data_destroyer(element->data);
+static uint16_t dictionary_match_control(int8_t *group, int8_t control) {
+#ifdef __SSE2__
+	__m128i controls = _mm_loadu_si128((__m128i*) group);
+	return _mm_movemask_epi8(_mm_cmpeq_epi8(controls, _mm_set1_epi8(control)));
+#else
+	uint16_t mask = 0;
+	for (int i = 0; i < DICTIONARY_GROUP_WIDTH; i++) {
+		if (group[i] == control) {
+			mask |= 1 << i;
+		}
 	}
-	free(element->key);
-	free(element);
+	return mask;
+#endif
+}
+
+static uint16_t dictionary_match_available(int8_t *group) {
+	// Los bytes de control vacíos o borrados son los únicos sin el bit más alto
+#ifdef __SSE2__
+	return ~_mm_movemask_epi8(_mm_loadu_si128((__m128i*) group)) & 0xFFFF;
+#else
+	uint16_t mask = 0;
+	for (int i = 0; i < DICTIONARY_GROUP_WIDTH; i++) {
+		if (!dictionary_is_full(group[i])) {
+			mask |= 1 << i;
+		}
+	}
+	return mask;
+#endif
+}
+
+static bool dictionary_is_full(int8_t control) {
+	return control < 0;
 }
@@ -18,9 +18,12 @@
 #define DICTIONARY_H_
 
 	#define DEFAULT_DICTIONARY_INITIAL_SIZE 20
+	#define DEFAULT_DICTIONARY_MAX_LOAD_FACTOR 0.875
 
 	#include "node.h"
 	#include <stdbool.h>
+	#include <stddef.h>
+	#include <stdint.h>
 	#include "list.h"
 
 	/**
@@ -28,16 +31,37 @@
 	 * @brief `#include <commons/collections/dictionary.h>`
 	 */
 
+	/** @cond INCLUDE_INTERNALS */
+	typedef struct {
+		t_hash_slot *elements;
+		int8_t *control;
+		int table_max_size;
+		int table_current_size;
+		int elements_amount;
+	} t_hash_table;
+	/** @endcond */
+
 	/**
 	 * @struct t_dictionary
 	 * @brief Estructura de un diccionario que contiene pares string->puntero.
 	 *        Inicializar con `dictionary_create()`.
+	 *
+	 * Los pares se guardan directamente en una tabla de direccionamiento
+	 * abierto, acompañada por un byte de control por posición que permite
+	 * comparar de a 16 posiciones a la vez.
+	 *
+	 * Las claves se hashean con una semilla aleatoria propia de cada
+	 * diccionario, por lo que no es posible elegir de antemano claves que
+	 * colisionen entre sí. Como consecuencia, el orden de iteración puede
+	 * cambiar de una ejecución a otra.
 	 */
 	typedef struct {
-		t_hash_element **elements;
-		int table_max_size;
-		int table_current_size;
-		int elements_amount;
+		t_hash_table table;
+		t_hash_table previous_table;
+		int rehash_index;
+		bool incremental_resize;
+		double max_load_factor;
+		uint64_t seed;
 	} t_dictionary;
 
 	/**
@@ -50,6 +74,65 @@
 	 */
 	t_dictionary *dictionary_create(void);
 
+	/**
+	 * @brief Crea el diccionario con lugar para al menos `capacity` elementos
+	 * @param capacity: Cantidad de elementos que se espera insertar. Mientras
+	 *                  no se supere, `dictionary_put()` no redimensiona la tabla.
+	 * @return Devuelve un puntero al diccionario creado, liberable de la misma
+	 *         forma que uno creado con `dictionary_create()`.
+	 *
+	 * Ejemplo de uso:
+	 * @code
+	 * t_dictionary* pages = dictionary_create_with_capacity(list_size(frames));
+	 * @endcode
+	 */
+	t_dictionary *dictionary_create_with_capacity(int capacity);
+
+	/**
+	 * @brief Crea el diccionario usando `seed` como semilla de la función de
+	 *        hash en lugar de una aleatoria.
+	 * @return Devuelve un puntero al diccionario creado, liberable de la misma
+	 *         forma que uno creado con `dictionary_create()`.
+	 *
+	 * @warning Con una semilla conocida es posible generar claves que
+	 *          colisionen. Usar sólo cuando se necesite reproducir exactamente
+	 *          la distribución de las claves, por ejemplo en pruebas.
+	 */
+	t_dictionary *dictionary_create_with_seed(uint64_t seed);
+
+	/**
+	 * @brief Cambia el factor de carga máximo de la tabla, es decir, la
+	 *        proporción de posiciones ocupadas a partir de la cual se
+	 *        redimensiona. Por defecto es `DEFAULT_DICTIONARY_MAX_LOAD_FACTOR`.
+	 * @param max_load_factor: Un valor entre 0 y 1. Valores bajos reducen el
+	 *                         largo de las búsquedas a cambio de más memoria.
+	 *
+	 * @note Si la tabla actual supera el nuevo factor, se redimensiona en
+	 *       la próxima inserción.
+	 */
+	void          dictionary_set_max_load_factor(t_dictionary *, double max_load_factor);
+
+	/**
+	 * @brief Redimensiona la tabla, si hace falta, para que entren al menos
+	 *        `capacity` elementos sin volver a redimensionarla.
+	 * @note Nunca achica la tabla.
+	 */
+	void          dictionary_reserve(t_dictionary *, int capacity);
+
+	/**
+	 * @brief Activa o desactiva el redimensionamiento incremental.
+	 *
+	 * Por defecto, cuando la tabla se llena se mueven todos los elementos a
+	 * una tabla nueva durante el `dictionary_put()` que lo provocó. En modo
+	 * incremental se mantienen ambas tablas y cada operación mueve sólo unas
+	 * pocas posiciones, evitando una pausa proporcional al tamaño del
+	 * diccionario a cambio de buscar en las dos tablas mientras dure la
+	 * migración.
+	 *
+	 * @note Al desactivarlo se completa la migración pendiente, si la hubiera.
+	 */
+	void          dictionary_set_incremental_resize(t_dictionary *, bool enabled);
+
 	/**
 	 * @brief Inserta un nuevo par (key->element) al diccionario, en caso de ya
 	 *        existir la key actualiza el elemento.
@@ -62,6 +145,15 @@
 	 */
 	void          dictionary_put(t_dictionary *, char *key, void *element);
 
+	/**
+	 * @brief Igual que `dictionary_put()`, pero recibiendo el largo de la key
+	 *        para evitar recorrerla con `strlen()`.
+	 * @param[in] key_len La cantidad de caracteres de la key. La key no necesita
+	 *                    estar terminada en '\\0' en esa posición, por lo que
+	 *                    puede ser parte de un buffer más grande.
+	 */
+	void          dictionary_put_with_length(t_dictionary *, char *key, size_t key_len, void *element);
+
 	/**
 	 * @brief Obtiene el elemento asociado a la key.
 	 * @return Devuelve un puntero perteneciente al diccionario, o NULL si no existe.
@@ -69,6 +161,59 @@
 	 */
 	void         *dictionary_get(t_dictionary *, char *key);
 
+	/**
+	 * @brief Igual que `dictionary_get()`, pero recibiendo el largo de la key.
+	 * @see dictionary_put_with_length
+	 */
+	void         *dictionary_get_with_length(t_dictionary *, char *key, size_t key_len);
+
+	/**
+	 * @brief Obtiene la posición donde se guarda el elemento asociado a la key,
+	 *        insertando el resultado de `factory` si la key no existía. La key
+	 *        se hashea y se busca una única vez.
+	 * @param[in] factory Recibe la copia de la key que guarda el diccionario y
+	 *                    retorna el elemento a insertar. Si es NULL se inserta
+	 *                    NULL como elemento.
+	 * @return Un puntero al elemento dentro del diccionario, que permite
+	 *         leerlo o reemplazarlo sin volver a buscar la key.
+	 *
+	 * @warning `factory` no debe modificar el diccionario, y el puntero
+	 *          retornado deja de ser válido luego de cualquier otra operación
+	 *          sobre él.
+	 *
+	 * Ejemplo de uso:
+	 * @code
+	 * void** count = dictionary_get_or_insert(counts, word, NULL);
+	 * *count = (void*) ((intptr_t) *count + 1);
+	 * @endcode
+	 */
+	void        **dictionary_get_or_insert(t_dictionary *, char *key, void*(*factory)(char* key));
+
+	/**
+	 * @brief Igual que `dictionary_get_or_insert()`, pero recibiendo el largo de la key.
+	 * @see dictionary_put_with_length
+	 */
+	void        **dictionary_get_or_insert_with_length(t_dictionary *, char *key, size_t key_len, void*(*factory)(char* key));
+
+	/**
+	 * @brief Reemplaza el elemento asociado a la key por el resultado de
+	 *        `remapping`, buscando la key una única vez.
+	 * @param[in] remapping Recibe la key y el elemento actual, o NULL si la key
+	 *                      no existía, y retorna el nuevo elemento. Si retorna
+	 *                      NULL, la key se quita del diccionario.
+	 * @return El nuevo elemento asociado a la key, o NULL si fue quitada.
+	 *
+	 * @warning `remapping` no debe modificar el diccionario. Tampoco se libera
+	 *          el elemento anterior: si ya no se usa, debe liberarlo `remapping`.
+	 */
+	void         *dictionary_compute(t_dictionary *, char *key, void*(*remapping)(char* key, void* element));
+
+	/**
+	 * @brief Igual que `dictionary_compute()`, pero recibiendo el largo de la key.
+	 * @see dictionary_put_with_length
+	 */
+	void         *dictionary_compute_with_length(t_dictionary *, char *key, size_t key_len, void*(*remapping)(char* key, void* element));
+
 	/**
 	 * @brief Remueve un elemento del diccionario y lo retorna.
 	 * @return Devuelve un puntero al elemento removido, o NULL si no existe.
@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include "dlist.h"
+
+static t_double_link_element *dlist_create_element(void *data);
+static void dlist_link_between(t_dlist *self, t_double_link_element *element, t_double_link_element *previous, t_double_link_element *next);
+static void dlist_unlink(t_dlist *self, t_double_link_element *element);
+
+t_dlist *dlist_create(void) {
+	t_dlist *self = malloc(sizeof(t_dlist));
+	self->head = NULL;
+	self->tail = NULL;
+	self->elements_count = 0;
+	return self;
+}
+
+t_double_link_element *dlist_add_first(t_dlist *self, void *data) {
+	t_double_link_element *element = dlist_create_element(data);
+	dlist_link_between(self, element, NULL, self->head);
+	return element;
+}
+
+t_double_link_element *dlist_add_last(t_dlist *self, void *data) {
+	t_double_link_element *element = dlist_create_element(data);
+	dlist_link_between(self, element, self->tail, NULL);
+	return element;
+}
+
+t_double_link_element *dlist_add_before(t_dlist *self, t_double_link_element *node, void *data) {
+	t_double_link_element *element = dlist_create_element(data);
+	dlist_link_between(self, element, node->previous, node);
+	return element;
+}
+
+t_double_link_element *dlist_add_after(t_dlist *self, t_double_link_element *node, void *data) {
+	t_double_link_element *element = dlist_create_element(data);
+	dlist_link_between(self, element, node, node->next);
+	return element;
+}
+
+void *dlist_get_first(t_dlist *self) {
+	return self->head != NULL ? self->head->data : NULL;
+}
+
+void *dlist_get_last(t_dlist *self) {
+	return self->tail != NULL ? self->tail->data : NULL;
+}
+
+void *dlist_remove_first(t_dlist *self) {
+	return self->head != NULL ? dlist_remove_node(self, self->head) : NULL;
+}
+
+void *dlist_remove_last(t_dlist *self) {
+	return self->tail != NULL ? dlist_remove_node(self, self->tail) : NULL;
+}
+
+void *dlist_remove_node(t_dlist *self, t_double_link_element *node) {
+	void *data = node->data;
+	dlist_unlink(self, node);
+	free(node);
+	return data;
+}
+
+void dlist_move_to_first(t_dlist *self, t_double_link_element *node) {
+	if (node != self->head) {
+		dlist_unlink(self, node);
+		dlist_link_between(self, node, NULL, self->head);
+	}
+}
+
+void dlist_move_to_last(t_dlist *self, t_double_link_element *node) {
+	if (node != self->tail) {
+		dlist_unlink(self, node);
+		dlist_link_between(self, node, self->tail, NULL);
+	}
+}
+
+void dlist_iterate(t_dlist *self, void(*closure)(void*)) {
+	for (t_double_link_element *element = self->head; element != NULL; element = element->next) {
+		closure(element->data);
+	}
+}
+
+void dlist_iterate_reverse(t_dlist *self, void(*closure)(void*)) {
+	for (t_double_link_element *element = self->tail; element != NULL; element = element->previous) {
+		closure(element->data);
+	}
+}
+
+int dlist_size(t_dlist *self) {
+	return self->elements_count;
+}
+
+bool dlist_is_empty(t_dlist *self) {
+	return self->elements_count == 0;
+}
+
+void dlist_clean(t_dlist *self) {
+	while (self->head != NULL) {
+		dlist_remove_node(self, self->head);
+	}
+}
+
+void dlist_clean_and_destroy_elements(t_dlist *self, void(*element_destroyer)(void*)) {
+	while (self->head != NULL) {
+		element_destroyer(dlist_remove_node(self, self->head));
+	}
+}
+
+void dlist_destroy(t_dlist *self) {
+	dlist_clean(self);
+	free(self);
+}
+
+void dlist_destroy_and_destroy_elements(t_dlist *self, void(*element_destroyer)(void*)) {
+	dlist_clean_and_destroy_elements(self, element_destroyer);
+	free(self);
+}
+
+/********* PRIVATE FUNCTIONS **************/
+
+static t_double_link_element *dlist_create_element(void *data) {
+	t_double_link_element *element = malloc(sizeof(t_double_link_element));
+	element->data = data;
+	return element;
+}
+
+static void dlist_link_between(t_dlist *self, t_double_link_element *element, t_double_link_element *previous, t_double_link_element *next) {
+	element->previous = previous;
+	element->next = next;
+	if (previous != NULL) {
+		previous->next = element;
+	} else {
+		self->head = element;
+	}
+	if (next != NULL) {
+		next->previous = element;
+	} else {
+		self->tail = element;
+	}
+	self->elements_count++;
+}
+
+static void dlist_unlink(t_dlist *self, t_double_link_element *element) {
+	if (element->previous != NULL) {
+		element->previous->next = element->next;
+	} else {
+		self->head = element->next;
+	}
+	if (element->next != NULL) {
+		element->next->previous = element->previous;
+	} else {
+		self->tail = element->previous;
+	}
+	self->elements_count--;
+}
@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DLIST_H_
+#define DLIST_H_
+
+	#include "node.h"
+	#include <stdbool.h>
+
+	/**
+	 * @file
+	 * @brief `#include <commons/collections/dlist.h>`
+	 */
+
+	/**
+	 * @struct t_dlist
+	 * @brief Lista doblemente enlazada. Inicializar con `dlist_create()`
+	 *
+	 * A diferencia de `t_list`, permite agregar y quitar en O(1) por ambos
+	 * extremos, y quitar o mover en O(1) un elemento a partir del nodo que se
+	 * obtuvo al agregarlo, por ejemplo para reemplazo de páginas LRU.
+	 */
+	typedef struct {
+		t_double_link_element *head;
+		t_double_link_element *tail;
+		int elements_count;
+	} t_dlist;
+
+	/**
+	 * @brief Crea una lista doblemente enlazada
+	 * @return Retorna un puntero a la lista creada, liberable con:
+	 *         - `dlist_destroy()` si se quiere liberar la lista pero no
+	 *           los elementos que contiene.
+	 *         - `dlist_destroy_and_destroy_elements()` si se quiere liberar
+	 *           la lista con los elementos que contiene
+	 *
+	 * Ejemplo de uso:
+	 * @code
+	 * t_dlist* lru = dlist_create();
+	 * page->lru_node = dlist_add_first(lru, page);
+	 * ...
+	 * // Al referenciar la página
+	 * dlist_move_to_first(lru, page->lru_node);
+	 * ...
+	 * // Al elegir una víctima
+	 * t_page* victim = dlist_remove_last(lru);
+	 * @endcode
+	 */
+	t_dlist *dlist_create(void);
+
+	/**
+	 * @brief Agrega un elemento al principio de la lista
+	 * @return El nodo del elemento, válido hasta que el elemento sea quitado
+	 *         de la lista.
+	 */
+	t_double_link_element *dlist_add_first(t_dlist *, void *data);
+
+	/**
+	 * @brief Agrega un elemento al final de la lista
+	 * @return El nodo del elemento, válido hasta que el elemento sea quitado
+	 *         de la lista.
+	 */
+	t_double_link_element *dlist_add_last(t_dlist *, void *data);
+
+	/**
+	 * @brief Agrega un elemento justo antes del nodo recibido
+	 * @return El nodo del elemento agregado.
+	 */
+	t_double_link_element *dlist_add_before(t_dlist *, t_double_link_element *node, void *data);
+
+	/**
+	 * @brief Agrega un elemento justo después del nodo recibido
+	 * @return El nodo del elemento agregado.
+	 */
+	t_double_link_element *dlist_add_after(t_dlist *, t_double_link_element *node, void *data);
+
+	/**
+	 * @brief Retorna el primer elemento de la lista, o NULL si está vacía
+	 */
+	void *dlist_get_first(t_dlist *);
+
+	/**
+	 * @brief Retorna el último elemento de la lista, o NULL si está vacía
+	 */
+	void *dlist_get_last(t_dlist *);
+
+	/**
+	 * @brief Quita el primer elemento de la lista
+	 * @return El elemento quitado, o NULL si la lista está vacía.
+	 */
+	void *dlist_remove_first(t_dlist *);
+
+	/**
+	 * @brief Quita el último elemento de la lista
+	 * @return El elemento quitado, o NULL si la lista está vacía.
+	 */
+	void *dlist_remove_last(t_dlist *);
+
+	/**
+	 * @brief Quita de la lista el elemento del nodo recibido, liberando el
+	 *        nodo.
+	 * @return El elemento quitado.
+	 */
+	void *dlist_remove_node(t_dlist *, t_double_link_element *node);
+
+	/**
+	 * @brief Mueve el nodo recibido al principio de la lista, sin liberarlo
+	 */
+	void dlist_move_to_first(t_dlist *, t_double_link_element *node);
+
+	/**
+	 * @brief Mueve el nodo recibido al final de la lista, sin liberarlo
+	 */
+	void dlist_move_to_last(t_dlist *, t_double_link_element *node);
+
+	/**
+	 * @brief Itera la lista del primer al último elemento, llamando a
+	 *        `closure` con cada uno.
+	 */
+	void dlist_iterate(t_dlist *, void(*closure)(void*));
+
+	/**
+	 * @brief Itera la lista del último al primer elemento, llamando a
+	 *        `closure` con cada uno.
+	 */
+	void dlist_iterate_reverse(t_dlist *, void(*closure)(void*));
+
+	/**
+	 * @brief Retorna la cantidad de elementos de la lista
+	 */
+	int dlist_size(t_dlist *);
+
+	/**
+	 * @brief Retorna true si la lista está vacía
+	 */
+	bool dlist_is_empty(t_dlist *);
+
+	/**
+	 * @brief Quita todos los elementos de la lista sin liberarlos
+	 */
+	void dlist_clean(t_dlist *);
+
+	/**
+	 * @brief Quita y libera todos los elementos de la lista
+	 */
+	void dlist_clean_and_destroy_elements(t_dlist *, void(*element_destroyer)(void*));
+
+	/**
+	 * @brief Destruye la lista sin liberar los elementos que contiene
+	 */
+	void dlist_destroy(t_dlist *);
+
+	/**
+	 * @brief Destruye la lista y los elementos que contiene
+	 */
+	void dlist_destroy_and_destroy_elements(t_dlist *, void(*element_destroyer)(void*));
+
+#endif /* DLIST_H_ */
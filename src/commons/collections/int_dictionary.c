@@ -0,0 +1,222 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "int_dictionary.h"
+
+static uint64_t int_dictionary_hash(uint64_t key);
+static int int_dictionary_home_index(t_int_dictionary *self, uint64_t key);
+static int int_dictionary_find_index(t_int_dictionary *self, uint64_t key);
+static void int_dictionary_table_create(t_int_dictionary *self, int capacity);
+static void int_dictionary_resize(t_int_dictionary *self, int new_max_size);
+static void int_dictionary_remove_index(t_int_dictionary *self, int index);
+static bool int_dictionary_is_between(int index, int from, int to);
+
+t_int_dictionary *int_dictionary_create() {
+	return int_dictionary_create_with_capacity(DEFAULT_INT_DICTIONARY_INITIAL_SIZE);
+}
+
+t_int_dictionary *int_dictionary_create_with_capacity(int capacity) {
+	t_int_dictionary *self = malloc(sizeof(t_int_dictionary));
+	int_dictionary_table_create(self, capacity);
+	return self;
+}
+
+void int_dictionary_put(t_int_dictionary *self, uint64_t key, void *data) {
+	// Con sondeo lineal se mantiene la tabla a lo sumo 3/4 llena
+	if ((self->elements_amount + 1) * 4 > self->table_max_size * 3) {
+		int_dictionary_resize(self, self->table_max_size * 2);
+	}
+
+	int mask = self->table_max_size - 1;
+	int index = int_dictionary_home_index(self, key);
+	while (self->used[index]) {
+		if (self->elements[index].key == key) {
+			self->elements[index].data = data;
+			return;
+		}
+		index = (index + 1) & mask;
+	}
+
+	self->used[index] = true;
+	self->elements[index] = (t_int_hash_slot) { .key = key, .data = data };
+	self->elements_amount++;
+}
+
+void *int_dictionary_get(t_int_dictionary *self, uint64_t key) {
+	int index = int_dictionary_find_index(self, key);
+	return index != -1 ? self->elements[index].data : NULL;
+}
+
+void *int_dictionary_remove(t_int_dictionary *self, uint64_t key) {
+	int index = int_dictionary_find_index(self, key);
+	if (index == -1) {
+		return NULL;
+	}
+
+	void *data = self->elements[index].data;
+	int_dictionary_remove_index(self, index);
+	return data;
+}
+
+void int_dictionary_remove_and_destroy(t_int_dictionary *self, uint64_t key, void(*data_destroyer)(void*)) {
+	void *data = int_dictionary_remove(self, key);
+
+	if (data != NULL) {
+		data_destroyer(data);
+	}
+}
+
+void int_dictionary_iterator(t_int_dictionary *self, void(*closure)(uint64_t,void*)) {
+	for (int index = 0; index < self->table_max_size; index++) {
+		if (self->used[index]) {
+			closure(self->elements[index].key, self->elements[index].data);
+		}
+	}
+}
+
+void int_dictionary_clean(t_int_dictionary *self) {
+	int_dictionary_clean_and_destroy_elements(self, NULL);
+}
+
+void int_dictionary_clean_and_destroy_elements(t_int_dictionary *self, void(*data_destroyer)(void*)) {
+	if (data_destroyer != NULL) {
+		void _destroy_element(uint64_t key, void *data) {
+			data_destroyer(data);
+		}
+		int_dictionary_iterator(self, _destroy_element);
+	}
+
+	memset(self->used, false, self->table_max_size * sizeof(bool));
+	self->elements_amount = 0;
+}
+
+bool int_dictionary_has_key(t_int_dictionary *self, uint64_t key) {
+	return int_dictionary_find_index(self, key) != -1;
+}
+
+bool int_dictionary_is_empty(t_int_dictionary *self) {
+	return self->elements_amount == 0;
+}
+
+int int_dictionary_size(t_int_dictionary *self) {
+	return self->elements_amount;
+}
+
+t_list *int_dictionary_elements(t_int_dictionary *self) {
+	t_list *values = list_create();
+
+	void add_value_to_list(uint64_t _, void *value) {
+		list_add(values, value);
+	}
+
+	int_dictionary_iterator(self, add_value_to_list);
+	return values;
+}
+
+void int_dictionary_destroy(t_int_dictionary *self) {
+	int_dictionary_destroy_and_destroy_elements(self, NULL);
+}
+
+void int_dictionary_destroy_and_destroy_elements(t_int_dictionary *self, void(*data_destroyer)(void*)) {
+	int_dictionary_clean_and_destroy_elements(self, data_destroyer);
+	free(self->elements);
+	free(self->used);
+	free(self);
+}
+
+/********* PRIVATE FUNCTIONS **************/
+
+static uint64_t int_dictionary_hash(uint64_t key) {
+	// Finalizador de MurmurHash3: claves consecutivas quedan dispersas en la tabla
+	key ^= key >> 33;
+	key *= 0xff51afd7ed558ccdull;
+	key ^= key >> 33;
+	key *= 0xc4ceb9fe1a85ec53ull;
+	key ^= key >> 33;
+	return key;
+}
+
+static int int_dictionary_home_index(t_int_dictionary *self, uint64_t key) {
+	return int_dictionary_hash(key) & (self->table_max_size - 1);
+}
+
+static int int_dictionary_find_index(t_int_dictionary *self, uint64_t key) {
+	int mask = self->table_max_size - 1;
+	int index = int_dictionary_home_index(self, key);
+	while (self->used[index]) {
+		if (self->elements[index].key == key) {
+			return index;
+		}
+		index = (index + 1) & mask;
+	}
+	return -1;
+}
+
+static void int_dictionary_table_create(t_int_dictionary *self, int capacity) {
+	int table_max_size = 16;
+	while (table_max_size * 3 < capacity * 4) {
+		table_max_size *= 2;
+	}
+
+	self->table_max_size = table_max_size;
+	self->elements_amount = 0;
+	self->elements = malloc(table_max_size * sizeof(t_int_hash_slot));
+	self->used = calloc(table_max_size, sizeof(bool));
+}
+
+static void int_dictionary_resize(t_int_dictionary *self, int new_max_size) {
+	t_int_hash_slot *old_elements = self->elements;
+	bool *old_used = self->used;
+	int old_max_size = self->table_max_size;
+
+	int_dictionary_table_create(self, new_max_size * 3 / 4);
+	for (int index = 0; index < old_max_size; index++) {
+		if (old_used[index]) {
+			int_dictionary_put(self, old_elements[index].key, old_elements[index].data);
+		}
+	}
+
+	free(old_elements);
+	free(old_used);
+}
+
+static void int_dictionary_remove_index(t_int_dictionary *self, int index) {
+	// En lugar de dejar una marca de borrado, se corren hacia atrás los
+	// elementos siguientes cuya posición original no quede salteada.
+	int mask = self->table_max_size - 1;
+	int next = index;
+	while (true) {
+		next = (next + 1) & mask;
+		if (!self->used[next]) {
+			break;
+		}
+		int home = int_dictionary_home_index(self, self->elements[next].key);
+		if (!int_dictionary_is_between(home, index, next)) {
+			self->elements[index] = self->elements[next];
+			index = next;
+		}
+	}
+
+	self->used[index] = false;
+	self->elements_amount--;
+}
+
+static bool int_dictionary_is_between(int index, int from, int to) {
+	// Retorna true si index está en el intervalo circular (from, to]
+	return from <= to ? from < index && index <= to : from < index || index <= to;
+}
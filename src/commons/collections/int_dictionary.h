@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef INT_DICTIONARY_H_
+#define INT_DICTIONARY_H_
+
+	#define DEFAULT_INT_DICTIONARY_INITIAL_SIZE 20
+
+	#include <stdbool.h>
+	#include <stdint.h>
+	#include "list.h"
+
+	/**
+	 * @file
+	 * @brief `#include <commons/collections/int_dictionary.h>`
+	 */
+
+	/** @cond INCLUDE_INTERNALS */
+	typedef struct {
+		uint64_t key;
+		void *data;
+	} t_int_hash_slot;
+	/** @endcond */
+
+	/**
+	 * @struct t_int_dictionary
+	 * @brief Diccionario que contiene pares entero->puntero, pensado para
+	 *        claves numéricas como PIDs, números de página o de marco.
+	 *        Inicializar con `int_dictionary_create()`.
+	 *
+	 * A diferencia de `t_dictionary`, las claves se guardan por valor dentro de
+	 * la tabla, por lo que no hace falta convertirlas a string ni se reserva
+	 * memoria por cada par insertado.
+	 */
+	typedef struct {
+		t_int_hash_slot *elements;
+		bool *used;
+		int table_max_size;
+		int elements_amount;
+	} t_int_dictionary;
+
+	/**
+	 * @brief Crea el diccionario
+	 * @return Devuelve un puntero al diccionario creado, liberable con:
+	 *         - `int_dictionary_destroy()` si se quiere liberar el diccionario
+	 *           pero no los elementos que contiene.
+	 *         - `int_dictionary_destroy_and_destroy_elements()` si se quieren
+	 *           liberar el diccionario con los elementos que contiene.
+	 */
+	t_int_dictionary *int_dictionary_create(void);
+
+	/**
+	 * @brief Crea el diccionario con lugar para al menos `capacity` elementos
+	 *        sin necesidad de redimensionarlo.
+	 * @see dictionary_create_with_capacity
+	 */
+	t_int_dictionary *int_dictionary_create_with_capacity(int capacity);
+
+	/**
+	 * @brief Inserta un nuevo par (key->element) al diccionario, en caso de ya
+	 *        existir la key actualiza el elemento.
+	 * @param[in] element El elemento a insertar. Este elemento pasará a pertenecer
+	 *            al diccionario, por lo que no debe ser liberado por fuera de éste.
+	 *
+	 * @warning Tener en cuenta que esto no va a liberar la memoria del `element` original.
+	 */
+	void              int_dictionary_put(t_int_dictionary *, uint64_t key, void *element);
+
+	/**
+	 * @brief Obtiene el elemento asociado a la key.
+	 * @return Devuelve un puntero perteneciente al diccionario, o NULL si no existe.
+	 *         Este puntero no debe ser liberado por fuera del diccionario.
+	 */
+	void             *int_dictionary_get(t_int_dictionary *, uint64_t key);
+
+	/**
+	 * @brief Remueve un elemento del diccionario y lo retorna.
+	 * @return Devuelve un puntero al elemento removido, o NULL si no existe.
+	 *         Al haberse removido, debe ser liberado por fuera del diccionario en
+	 *         caso de ser necesario.
+	 */
+	void             *int_dictionary_remove(t_int_dictionary *, uint64_t key);
+
+	/**
+	 * @brief Remueve un elemento del diccionario y lo destruye llamando a la función
+	 *        `element_destroyer` pasada por parámetro.
+	 */
+	void              int_dictionary_remove_and_destroy(t_int_dictionary *, uint64_t key, void(*element_destroyer)(void*));
+
+	/**
+	 * @brief Aplica `closure` a todos los elementos del diccionario.
+	 */
+	void              int_dictionary_iterator(t_int_dictionary *, void(*closure)(uint64_t key, void* element));
+
+	/**
+	 * @brief Quita todos los elementos del diccionario sin liberarlos, dejando el
+	 *        diccionario vacío.
+	 */
+	void              int_dictionary_clean(t_int_dictionary *);
+
+	/**
+	 * @brief Quita todos los elementos del diccionario y los destruye, dejando el
+	 *        diccionario vacío.
+	 */
+	void              int_dictionary_clean_and_destroy_elements(t_int_dictionary *, void(*element_destroyer)(void*));
+
+	/**
+	 * @brief Retorna true si `key` se encuentra en el diccionario
+	 */
+	bool              int_dictionary_has_key(t_int_dictionary *, uint64_t key);
+
+	/**
+	 * @brief Retorna true si el diccionario está vacío
+	 */
+	bool              int_dictionary_is_empty(t_int_dictionary *);
+
+	/**
+	 * @brief Retorna la cantidad de elementos del diccionario
+	 */
+	int               int_dictionary_size(t_int_dictionary *);
+
+	/**
+	 * @brief Retorna todos los elementos en una lista
+	 */
+	t_list           *int_dictionary_elements(t_int_dictionary *);
+
+	/**
+	 * @brief Destruye el diccionario
+	 */
+	void              int_dictionary_destroy(t_int_dictionary *);
+
+	/**
+	 * @brief Destruye el diccionario y destruye sus elementos
+	 */
+	void              int_dictionary_destroy_and_destroy_elements(t_int_dictionary *, void(*element_destroyer)(void*));
+
+#endif /* INT_DICTIONARY_H_ */
@@ -15,12 +15,43 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 
 #include "list.h"
-
-static t_link_element *list_create_element(void* data);
+#include "../threadpool.h"
+
+// Las operaciones paralelas dividen la lista en hasta
+// LIST_PARALLEL_CHUNKS_PER_THREAD porciones por hilo, para repartir mejor el
+// trabajo si algunas porciones tardan más, pero de al menos
+// LIST_PARALLEL_MIN_CHUNK_SIZE elementos para que el envío de cada tarea no
+// cueste más que la tarea en sí.
+#define LIST_PARALLEL_CHUNKS_PER_THREAD 4
+#define LIST_PARALLEL_MIN_CHUNK_SIZE 1024
+
+// Posición de un elemento en cualquiera de los dos tipos de lista
+typedef struct {
+	t_link_element *element;
+	t_unrolled_link_element *node;
+	int offset;
+} t_list_position;
+
+typedef struct {
+	t_list_position first;
+	bool unrolled;
+	int count;
+	void *(*transformer)(void*);
+	bool (*condition)(void*);
+	void *(*operation)(void*, void*);
+	t_list *result;
+	void *folded;
+} t_list_chunk;
+
+static t_list *list_create_like(t_list *self);
+static t_link_element *list_create_element(t_list* self, void* data);
+static void list_destroy_element(t_list* self, t_link_element* element);
 static void list_link_element(t_list* self, t_link_element** indirect, t_link_element* element);
 static t_link_element *list_unlink_element(t_list* self, t_link_element** indirect);
+static void list_invalidate_cursor(t_list *self);
 static t_link_element **list_get_indirect_in_index(t_list *self, int index);
 static t_link_element **list_get_indirect_by_condition(t_list *self, bool(*condition)(void*));
 static void list_add_element(t_list *self, t_link_element **indirect, void *data);
@@ -29,45 +60,113 @@ static void *list_remove_indirect(t_list *self, t_link_element **indirect);
 static void list_iterate_indirects(t_list* self, int start, int count, bool (*removed)(t_link_element**));
 static int list_add_element_sorted(t_list *self, t_link_element* element, bool (*comparator)(void*,void*));
 static void* list_fold_elements(t_link_element* element, void* seed, void*(*operation)(void*, void*));
+static t_link_element *list_split_run(t_link_element *element, int length);
+static t_link_element **list_merge_runs(t_link_element **indirect, t_link_element *left, t_link_element *right, bool (*comparator)(void*,void*));
+static t_unrolled_link_element *list_unrolled_create_node(t_list *self, t_unrolled_link_element *previous);
+static void list_unrolled_destroy_node(t_list *self, t_unrolled_link_element *node);
+static void list_unrolled_append(t_list *self, void *data);
+static t_unrolled_link_element *list_unrolled_locate(t_list *self, int index, int *offset);
+static t_unrolled_link_element *list_unrolled_find(t_list *self, bool(*condition)(void*), int *offset);
+static void list_unrolled_insert(t_list *self, t_unrolled_link_element **node, int *offset, void *data);
+static void *list_unrolled_remove(t_list *self, t_unrolled_link_element **node, int *offset);
+static void list_unrolled_advance(t_unrolled_link_element **node, int *offset);
+static void list_unrolled_clean(t_list *self);
+static void list_unrolled_sort(t_list *self, bool (*comparator)(void*,void*));
+static t_list_position list_position_first(t_list *self);
+static void *list_position_data(t_list_position *position);
+static void list_position_advance(t_list_position *position);
+static t_list_chunk *list_split_chunks(t_list *self, t_threadpool *threads, int *chunks_count);
+static void list_run_chunks(t_threadpool *threads, t_list_chunk *chunks, int chunks_count, void *(*task)(void*));
+static t_list *list_join_chunks(t_list *self, t_list_chunk *chunks, int chunks_count);
+static void *list_map_chunk(void *chunk);
+static void *list_filter_chunk(void *chunk);
+static void *list_fold_chunk(void *chunk);
 
 t_list *list_create() {
+	return list_create_with_pool(NULL);
+}
+
+t_list *list_create_with_pool(t_node_pool *pool) {
 	t_list *list = malloc(sizeof(t_list));
 	list->head = NULL;
+	list->tail = &list->head;
 	list->elements_count = 0;
+	list->pool = pool;
+	list->unrolled = false;
+	list->unrolled_head = NULL;
+	list->unrolled_tail = NULL;
+	list->cursor = NULL;
+	list->cursor_node = NULL;
+	list->cursor_index = 0;
+	return list;
+}
+
+t_list *list_create_unrolled() {
+	t_list *list = list_create_with_pool(NULL);
+	list->unrolled = true;
 	return list;
 }
 
 int list_add(t_list *self, void *data) {
-	t_link_element **indirect = list_get_indirect_in_index(self, list_size(self));
-	list_add_element(self, indirect, data);
+	if (self->unrolled) {
+		list_unrolled_append(self, data);
+	} else {
+		list_add_element(self, self->tail, data);
+	}
 	return list_size(self) - 1;
 }
 
 void list_add_all(t_list* self, t_list* other) {
-	t_link_element **indirect = list_get_indirect_in_index(self, list_size(self));
 	void _add_data(void *data) {
-		list_add_element(self, indirect, data);
-		indirect = &(*indirect)->next;
+		list_add(self, data);
 	}
 	list_iterate(other, _add_data);
 }
 
 void* list_get(t_list *self, int index) {
+	if (self->unrolled) {
+		int offset;
+		t_unrolled_link_element *node = list_unrolled_locate(self, index, &offset);
+		return node->data[offset];
+	}
 	t_link_element **indirect = list_get_indirect_in_index(self, index);
 	return (*indirect)->data;
 }
 
 void list_add_in_index(t_list *self, int index, void *data) {
+	if (self->unrolled) {
+		int offset;
+		t_unrolled_link_element *node = list_unrolled_locate(self, index, &offset);
+		list_unrolled_insert(self, &node, &offset, data);
+		return;
+	}
 	t_link_element **indirect = list_get_indirect_in_index(self, index);
 	list_add_element(self, indirect, data);
 }
 
 void *list_replace(t_list *self, int index, void *data) {
+	if (self->unrolled) {
+		int offset;
+		t_unrolled_link_element *node = list_unrolled_locate(self, index, &offset);
+		void *old_data = node->data[offset];
+		node->data[offset] = data;
+		return old_data;
+	}
 	t_link_element **indirect = list_get_indirect_in_index(self, index);
 	return list_replace_indirect(indirect, data);
 }
 
 void *list_replace_by_condition(t_list* self, bool(*condition)(void*), void* element) {
+	if (self->unrolled) {
+		int offset;
+		t_unrolled_link_element *node = list_unrolled_find(self, condition, &offset);
+		if (node == NULL) {
+			return NULL;
+		}
+		void *old_data = node->data[offset];
+		node->data[offset] = element;
+		return old_data;
+	}
 	t_link_element **indirect = list_get_indirect_by_condition(self, condition);
 	return (*indirect) != NULL ? list_replace_indirect(indirect, element) : NULL;
 }
@@ -78,11 +177,24 @@ void list_replace_and_destroy_element(t_list *self, int index, void *data, void(
 }
 
 void* list_find(t_list *self, bool(*condition)(void*)) {
+	if (self->unrolled) {
+		int offset;
+		t_unrolled_link_element *node = list_unrolled_find(self, condition, &offset);
+		return node != NULL ? node->data[offset] : NULL;
+	}
 	t_link_element **indirect = list_get_indirect_by_condition(self, condition);
 	return (*indirect) != NULL ? (*indirect)->data : NULL;
 }
 
 void list_iterate(t_list* self, void(*closure)(void*)) {
+	if (self->unrolled) {
+		for (t_unrolled_link_element *node = self->unrolled_head; node != NULL; node = node->next) {
+			for (int i = 0; i < node->count; i++) {
+				closure(node->data[i]);
+			}
+		}
+		return;
+	}
 	t_link_element **indirect = &self->head;
 	while ((*indirect) != NULL) {
 		closure((*indirect)->data);
@@ -91,6 +203,11 @@ void list_iterate(t_list* self, void(*closure)(void*)) {
 }
 
 void *list_remove(t_list *self, int index) {
+	if (self->unrolled) {
+		int offset;
+		t_unrolled_link_element *node = list_unrolled_locate(self, index, &offset);
+		return list_unrolled_remove(self, &node, &offset);
+	}
 	t_link_element **indirect = list_get_indirect_in_index(self, index);
 	return list_remove_indirect(self, indirect);
 }
@@ -103,6 +220,11 @@ bool list_remove_element(t_list *self, void *element) {
 }
 
 void* list_remove_by_condition(t_list *self, bool(*condition)(void*)) {
+	if (self->unrolled) {
+		int offset;
+		t_unrolled_link_element *node = list_unrolled_find(self, condition, &offset);
+		return node != NULL ? list_unrolled_remove(self, &node, &offset) : NULL;
+	}
 	t_link_element **indirect = list_get_indirect_by_condition(self, condition);
 	return (*indirect) != NULL ? list_remove_indirect(self, indirect) : NULL;
 }
@@ -120,6 +242,18 @@ void list_remove_and_destroy_by_condition(t_list *self, bool(*condition)(void*),
 }
 
 void list_remove_and_destroy_all_by_condition(t_list *self, bool(*condition)(void*), void(*element_destroyer)(void*)) {
+	if (self->unrolled) {
+		t_unrolled_link_element *node = self->unrolled_head;
+		int offset = 0;
+		while (node != NULL) {
+			if (condition(node->data[offset])) {
+				element_destroyer(list_unrolled_remove(self, &node, &offset));
+			} else {
+				list_unrolled_advance(&node, &offset);
+			}
+		}
+		return;
+	}
 	t_link_element **indirect = &self->head;
 	while ((*indirect) != NULL) {
 		if (condition((*indirect)->data)) {
@@ -139,6 +273,10 @@ bool list_is_empty(t_list *list) {
 }
 
 void list_clean(t_list *self) {
+	if (self->unrolled) {
+		list_unrolled_clean(self);
+		return;
+	}
 	while (!list_is_empty(self)) {
 		list_remove_indirect(self, &self->head);
 	}
@@ -164,7 +302,16 @@ t_list* list_take(t_list* self, int count) {
 }
 
 t_list* list_slice(t_list* self, int start, int count) {
-	t_list* sublist = list_create();
+	t_list* sublist = list_create_like(self);
+	if (self->unrolled) {
+		int offset;
+		t_unrolled_link_element *node = list_unrolled_locate(self, start, &offset);
+		for (int i = 0; i < count && node != NULL && offset < node->count; i++) {
+			list_unrolled_append(sublist, node->data[offset]);
+			list_unrolled_advance(&node, &offset);
+		}
+		return sublist;
+	}
 	t_link_element **sublist_indirect = &sublist->head;
 
 	bool _add_to_sublist(t_link_element **self_indirect) {
@@ -178,7 +325,15 @@ t_list* list_slice(t_list* self, int start, int count) {
 }
 
 t_list* list_slice_and_remove(t_list* self, int start, int count) {
-	t_list* sublist = list_create();
+	t_list* sublist = list_create_like(self);
+	if (self->unrolled) {
+		int offset;
+		t_unrolled_link_element *node = list_unrolled_locate(self, start, &offset);
+		for (int i = 0; i < count && node != NULL && offset < node->count; i++) {
+			list_unrolled_append(sublist, list_unrolled_remove(self, &node, &offset));
+		}
+		return sublist;
+	}
 	t_link_element **sublist_indirect = &sublist->head;
 
 	bool _move_from_self_to_sublist(t_link_element **self_indirect) {
@@ -196,13 +351,11 @@ t_list* list_take_and_remove(t_list* self, int count) {
 }
 
 t_list* list_filter(t_list* self, bool(*condition)(void*)){
-	t_list *sublist = list_create();
-	t_link_element **indirect = &sublist->head;
+	t_list *sublist = list_create_like(self);
 
 	void _add_by_condition(void* data) {
 		if (condition(data)) {
-			list_add_element(sublist, indirect, data);
-			indirect = &(*indirect)->next;
+			list_add(sublist, data);
 		}
 	}
 	list_iterate(self, _add_by_condition);
@@ -211,28 +364,41 @@ t_list* list_filter(t_list* self, bool(*condition)(void*)){
 }
 
 t_list* list_map(t_list* self, void*(*transformer)(void*)){
-	t_list *sublist = list_create();
-	t_link_element **indirect = &sublist->head;
+	t_list *sublist = list_create_like(self);
 
 	void _map_data(void* data) {
-		list_add_element(sublist, indirect, transformer(data));
-		indirect = &(*indirect)->next;
+		list_add(sublist, transformer(data));
 	}
 	list_iterate(self, _map_data);
 
 	return sublist;
 }
 
+t_list* list_parallel_filter(t_list* self, t_threadpool* threads, bool(*condition)(void*)) {
+	int chunks_count;
+	t_list_chunk *chunks = list_split_chunks(self, threads, &chunks_count);
+	for (int i = 0; i < chunks_count; i++) {
+		chunks[i].condition = condition;
+	}
+	list_run_chunks(threads, chunks, chunks_count, list_filter_chunk);
+	return list_join_chunks(self, chunks, chunks_count);
+}
+
+t_list* list_parallel_map(t_list* self, t_threadpool* threads, void*(*transformer)(void*)) {
+	int chunks_count;
+	t_list_chunk *chunks = list_split_chunks(self, threads, &chunks_count);
+	for (int i = 0; i < chunks_count; i++) {
+		chunks[i].transformer = transformer;
+	}
+	list_run_chunks(threads, chunks, chunks_count, list_map_chunk);
+	return list_join_chunks(self, chunks, chunks_count);
+}
+
 t_list* list_flatten(t_list* self) {
-	t_list *sublist = list_create();
-	t_link_element **indirect = &sublist->head;
+	t_list *sublist = list_create_like(self);
 
 	void _flatten_data(t_list* list) {
-		void _add_data(void* data) {
-			list_add_element(sublist, indirect, data);
-			indirect = &(*indirect)->next;
-		}
-		list_iterate(list, (void*) _add_data);
+		list_add_all(sublist, list);
 	}
 	list_iterate(self, (void*) _flatten_data);
 
@@ -240,16 +406,41 @@ t_list* list_flatten(t_list* self) {
 }
 
 int list_add_sorted(t_list *self, void* data, bool (*comparator)(void*,void*)) {
-	return list_add_element_sorted(self, list_create_element(data), comparator);
+	if (self->unrolled) {
+		t_unrolled_link_element *node = self->unrolled_head;
+		int offset = 0;
+		int index = 0;
+		while (node != NULL && comparator(node->data[offset], data)) {
+			list_unrolled_advance(&node, &offset);
+			index++;
+		}
+		if (node == NULL && self->unrolled_tail != NULL) {
+			node = self->unrolled_tail;
+			offset = node->count;
+		}
+		list_unrolled_insert(self, &node, &offset, data);
+		return index;
+	}
+	return list_add_element_sorted(self, list_create_element(self, data), comparator);
 }
 
 void list_sort(t_list *self, bool (*comparator)(void *, void *)) {
-	t_list *aux = list_create();
-	while (!list_is_empty(self)) {
-		list_add_element_sorted(aux, list_unlink_element(self, &self->head), comparator);
+	if (self->unrolled) {
+		list_unrolled_sort(self, comparator);
+		return;
 	}
-	*self = *aux;
-	free(aux);
+	for (int width = 1; width < list_size(self); width *= 2) {
+		t_link_element **indirect = &self->head;
+		t_link_element *remaining = self->head;
+		while (remaining != NULL) {
+			t_link_element *left = remaining;
+			t_link_element *right = list_split_run(left, width);
+			remaining = list_split_run(right, width);
+			indirect = list_merge_runs(indirect, left, right, comparator);
+		}
+		self->tail = indirect;
+	}
+	list_invalidate_cursor(self);
 }
 
 t_list* list_sorted(t_list* self, bool (*comparator)(void *, void *)) {
@@ -278,19 +469,54 @@ bool list_all_satisfy(t_list* self, bool(*condition)(void*)){
 }
 
 t_list* list_duplicate(t_list* self) {
-	t_list* duplicated = list_create();
+	t_list* duplicated = list_create_like(self);
 	list_add_all(duplicated, self);
 	return duplicated;
 }
 
 void* list_fold1(t_list* self, void* (*operation)(void*, void*)) {
+	if (self->unrolled) {
+		t_unrolled_link_element *node = self->unrolled_head;
+		int offset = 0;
+		void *result = node->data[0];
+		list_unrolled_advance(&node, &offset);
+		for (; node != NULL; list_unrolled_advance(&node, &offset)) {
+			result = operation(result, node->data[offset]);
+		}
+		return result;
+	}
 	return list_fold_elements(self->head->next, self->head->data, operation);
 }
 
 void* list_fold(t_list* self, void* seed, void*(*operation)(void*, void*)) {
+	if (self->unrolled) {
+		void *result = seed;
+		for (t_unrolled_link_element *node = self->unrolled_head; node != NULL; node = node->next) {
+			for (int i = 0; i < node->count; i++) {
+				result = operation(result, node->data[i]);
+			}
+		}
+		return result;
+	}
 	return list_fold_elements(self->head, seed, operation);
 }
 
+void* list_parallel_fold(t_list* self, t_threadpool* threads, void* seed, void*(*operation)(void*, void*)) {
+	int chunks_count;
+	t_list_chunk *chunks = list_split_chunks(self, threads, &chunks_count);
+	for (int i = 0; i < chunks_count; i++) {
+		chunks[i].operation = operation;
+	}
+	list_run_chunks(threads, chunks, chunks_count, list_fold_chunk);
+
+	void *result = seed;
+	for (int i = 0; i < chunks_count; i++) {
+		result = operation(result, chunks[i].folded);
+	}
+	free(chunks);
+	return result;
+}
+
 void* list_get_minimum(t_list* self, void* (*minimum)(void*, void*)) {
 	return list_fold1(self, minimum);
 }
@@ -305,14 +531,28 @@ t_list_iterator* list_iterator_create(t_list* list) {
 	new->actual = NULL;
 	new->next = &list->head;
 	new->index = -1;
+	new->actual_node = NULL;
+	new->actual_offset = 0;
+	new->next_node = list->unrolled_head;
+	new->next_offset = 0;
 	return new;
 }
 
 bool list_iterator_has_next(t_list_iterator* iterator) {
+	if (iterator->list->unrolled) {
+		return iterator->next_node != NULL;
+	}
 	return (*iterator->next) != NULL;
 }
 
 void* list_iterator_next(t_list_iterator* iterator) {
+	if (iterator->list->unrolled) {
+		iterator->actual_node = iterator->next_node;
+		iterator->actual_offset = iterator->next_offset;
+		list_unrolled_advance(&iterator->next_node, &iterator->next_offset);
+		iterator->index++;
+		return iterator->actual_node->data[iterator->actual_offset];
+	}
 	iterator->actual = iterator->next;
 	iterator->next = &(*iterator->next)->next;
 	iterator->index++;
@@ -324,6 +564,22 @@ int list_iterator_index(t_list_iterator* iterator) {
 }
 
 void list_iterator_add(t_list_iterator* iterator, void *data) {
+	if (iterator->list->unrolled) {
+		t_unrolled_link_element *node = iterator->next_node;
+		int offset = iterator->next_offset;
+		if (node == NULL && iterator->list->unrolled_tail != NULL) {
+			node = iterator->list->unrolled_tail;
+			offset = node->count;
+		}
+		list_unrolled_insert(iterator->list, &node, &offset, data);
+		iterator->actual_node = node;
+		iterator->actual_offset = offset;
+		list_unrolled_advance(&node, &offset);
+		iterator->next_node = node;
+		iterator->next_offset = offset;
+		iterator->index++;
+		return;
+	}
 	iterator->actual = iterator->next;
 	list_add_element(iterator->list, iterator->actual, data);
 	iterator->next = &(*iterator->actual)->next;
@@ -331,6 +587,15 @@ void list_iterator_add(t_list_iterator* iterator, void *data) {
 }
 
 void list_iterator_remove(t_list_iterator* iterator) {
+	if (iterator->list->unrolled) {
+		t_unrolled_link_element *node = iterator->actual_node;
+		int offset = iterator->actual_offset;
+		list_unrolled_remove(iterator->list, &node, &offset);
+		iterator->next_node = node;
+		iterator->next_offset = offset;
+		iterator->index--;
+		return;
+	}
 	list_remove_indirect(iterator->list, iterator->actual);
 	iterator->next = iterator->actual;
 	iterator->index--;
@@ -342,31 +607,69 @@ void list_iterator_destroy(t_list_iterator* iterator) {
 
 /********* PRIVATE FUNCTIONS **************/
 
-static t_link_element* list_create_element(void* data) {
-	t_link_element* element = malloc(sizeof(t_link_element));
+static t_list *list_create_like(t_list *self) {
+	return self->unrolled ? list_create_unrolled() : list_create_with_pool(self->pool);
+}
+
+static t_link_element* list_create_element(t_list* self, void* data) {
+	t_link_element* element = self->pool != NULL ? node_pool_alloc(self->pool) : malloc(sizeof(t_link_element));
 	element->data = data;
 	element->next = NULL;
 	return element;
 }
 
+static void list_destroy_element(t_list* self, t_link_element* element) {
+	if (self->pool != NULL) {
+		node_pool_free(self->pool, element);
+	} else {
+		free(element);
+	}
+}
+
 static void list_link_element(t_list* self, t_link_element** indirect, t_link_element* element) {
+	// Agregar en la posición del cursor o al final no mueve a los elementos
+	// anteriores a él, por lo que sólo otras posiciones lo invalidan
+	if (indirect != self->cursor && indirect != self->tail) {
+		list_invalidate_cursor(self);
+	}
 	element->next = *indirect;
 	*indirect = element;
+	if (element->next == NULL) {
+		self->tail = &element->next;
+	}
 	self->elements_count++;
 }
 
 static t_link_element* list_unlink_element(t_list* self, t_link_element** indirect) {
+	if (indirect != self->cursor) {
+		list_invalidate_cursor(self);
+	}
 	t_link_element* element = *indirect;
 	*indirect = element->next;
+	if (*indirect == NULL) {
+		self->tail = indirect;
+	}
 	self->elements_count--;
 	return element;
 }
 
+static void list_invalidate_cursor(t_list *self) {
+	self->cursor = NULL;
+	self->cursor_node = NULL;
+}
+
 static t_link_element **list_get_indirect_in_index(t_list *self, int index) {
 	t_link_element **indirect = &self->head;
-	for (int i = 0; i < index; ++i) {
+	int i = 0;
+	if (self->cursor != NULL && self->cursor_index <= index) {
+		indirect = self->cursor;
+		i = self->cursor_index;
+	}
+	for (; i < index; ++i) {
 		indirect = &(*indirect)->next;
 	}
+	self->cursor = indirect;
+	self->cursor_index = index;
 	return indirect;
 }
 
@@ -379,7 +682,7 @@ static t_link_element **list_get_indirect_by_condition(t_list *self, bool(*condi
 }
 
 static void list_add_element(t_list *self, t_link_element **indirect, void *data) {
-	list_link_element(self, indirect, list_create_element(data));
+	list_link_element(self, indirect, list_create_element(self, data));
 }
 
 static void *list_replace_indirect(t_link_element **indirect, void *data) {
@@ -391,7 +694,7 @@ static void *list_replace_indirect(t_link_element **indirect, void *data) {
 static void *list_remove_indirect(t_list *self, t_link_element **indirect) {
 	t_link_element *element = list_unlink_element(self, indirect);
 	void *data = element->data;
-	free(element);
+	list_destroy_element(self, element);
 	return data;
 }
 
@@ -427,3 +730,402 @@ static void* list_fold_elements(t_link_element* element, void* seed, void*(*oper
 
 	return result;
 }
+
+static t_link_element *list_split_run(t_link_element *element, int length) {
+	for (int i = 1; element != NULL && i < length; i++) {
+		element = element->next;
+	}
+	if (element == NULL) {
+		return NULL;
+	}
+	t_link_element *next = element->next;
+	element->next = NULL;
+	return next;
+}
+
+static t_link_element **list_merge_runs(t_link_element **indirect, t_link_element *left, t_link_element *right, bool (*comparator)(void*,void*)) {
+	while (left != NULL && right != NULL) {
+		if (comparator(left->data, right->data)) {
+			*indirect = left;
+			left = left->next;
+		} else {
+			*indirect = right;
+			right = right->next;
+		}
+		indirect = &(*indirect)->next;
+	}
+	*indirect = left != NULL ? left : right;
+	while (*indirect != NULL) {
+		indirect = &(*indirect)->next;
+	}
+	return indirect;
+}
+
+static t_list_chunk *list_split_chunks(t_list *self, t_threadpool *threads, int *chunks_count) {
+	int count = threadpool_size(threads) * LIST_PARALLEL_CHUNKS_PER_THREAD;
+	if (count > self->elements_count / LIST_PARALLEL_MIN_CHUNK_SIZE) {
+		count = self->elements_count / LIST_PARALLEL_MIN_CHUNK_SIZE;
+	}
+	if (count < 1) {
+		count = self->elements_count > 0 ? 1 : 0;
+	}
+
+	t_list_chunk *chunks = calloc(count, sizeof(t_list_chunk));
+	t_list_position position = list_position_first(self);
+	for (int i = 0; i < count; i++) {
+		// Las porciones difieren a lo sumo en un elemento
+		chunks[i].first = position;
+		chunks[i].unrolled = self->unrolled;
+		chunks[i].count = self->elements_count / count + (i < self->elements_count % count ? 1 : 0);
+		for (int j = 0; j < chunks[i].count; j++) {
+			list_position_advance(&position);
+		}
+	}
+
+	*chunks_count = count;
+	return chunks;
+}
+
+static void list_run_chunks(t_threadpool *threads, t_list_chunk *chunks, int chunks_count, void *(*task)(void*)) {
+	t_future **futures = malloc(chunks_count * sizeof(t_future*));
+	for (int i = 0; i < chunks_count; i++) {
+		futures[i] = threadpool_submit(threads, task, &chunks[i]);
+	}
+	for (int i = 0; i < chunks_count; i++) {
+		threadpool_join(threads, futures[i]);
+	}
+	free(futures);
+}
+
+static t_list *list_join_chunks(t_list *self, t_list_chunk *chunks, int chunks_count) {
+	t_list *joined = list_create_like(self);
+
+	// Las porciones arman sus nodos con malloc(), porque los pools de nodos no
+	// pueden usarse desde varios hilos: si la lista usa un pool, los nodos se
+	// copian a la lista resultante en vez de enlazarse
+	for (int i = 0; i < chunks_count; i++) {
+		t_list *result = chunks[i].result;
+		if (joined->unrolled && result->unrolled_head != NULL) {
+			result->unrolled_head->previous = joined->unrolled_tail;
+			if (joined->unrolled_tail != NULL) {
+				joined->unrolled_tail->next = result->unrolled_head;
+			} else {
+				joined->unrolled_head = result->unrolled_head;
+			}
+			joined->unrolled_tail = result->unrolled_tail;
+			joined->elements_count += result->elements_count;
+			free(result);
+		} else if (!joined->unrolled && joined->pool == NULL && result->head != NULL) {
+			*joined->tail = result->head;
+			joined->tail = result->tail;
+			joined->elements_count += result->elements_count;
+			free(result);
+		} else {
+			list_add_all(joined, result);
+			list_destroy(result);
+		}
+	}
+
+	free(chunks);
+	return joined;
+}
+
+static void *list_map_chunk(void *chunk) {
+	t_list_chunk *self = chunk;
+	self->result = self->unrolled ? list_create_unrolled() : list_create();
+	t_list_position position = self->first;
+	for (int i = 0; i < self->count; i++) {
+		list_add(self->result, self->transformer(list_position_data(&position)));
+		list_position_advance(&position);
+	}
+	return NULL;
+}
+
+static void *list_filter_chunk(void *chunk) {
+	t_list_chunk *self = chunk;
+	self->result = self->unrolled ? list_create_unrolled() : list_create();
+	t_list_position position = self->first;
+	for (int i = 0; i < self->count; i++) {
+		void *data = list_position_data(&position);
+		if (self->condition(data)) {
+			list_add(self->result, data);
+		}
+		list_position_advance(&position);
+	}
+	return NULL;
+}
+
+static void *list_fold_chunk(void *chunk) {
+	t_list_chunk *self = chunk;
+	t_list_position position = self->first;
+	self->folded = list_position_data(&position);
+	for (int i = 1; i < self->count; i++) {
+		list_position_advance(&position);
+		self->folded = self->operation(self->folded, list_position_data(&position));
+	}
+	return NULL;
+}
+
+static t_unrolled_link_element *list_unrolled_create_node(t_list *self, t_unrolled_link_element *previous) {
+	t_unrolled_link_element *node = malloc(sizeof(t_unrolled_link_element));
+	node->count = 0;
+	node->previous = previous;
+	node->next = previous != NULL ? previous->next : self->unrolled_head;
+	if (node->previous != NULL) {
+		node->previous->next = node;
+	} else {
+		self->unrolled_head = node;
+	}
+	if (node->next != NULL) {
+		node->next->previous = node;
+	} else {
+		self->unrolled_tail = node;
+	}
+	return node;
+}
+
+static void list_unrolled_destroy_node(t_list *self, t_unrolled_link_element *node) {
+	if (node == self->cursor_node) {
+		list_invalidate_cursor(self);
+	}
+	if (node->previous != NULL) {
+		node->previous->next = node->next;
+	} else {
+		self->unrolled_head = node->next;
+	}
+	if (node->next != NULL) {
+		node->next->previous = node->previous;
+	} else {
+		self->unrolled_tail = node->previous;
+	}
+	free(node);
+}
+
+static void list_unrolled_append(t_list *self, void *data) {
+	t_unrolled_link_element *tail = self->unrolled_tail;
+	if (tail == NULL || tail->count == UNROLLED_LINK_ELEMENT_CAPACITY) {
+		tail = list_unrolled_create_node(self, tail);
+	}
+	tail->data[tail->count++] = data;
+	self->elements_count++;
+}
+
+static t_unrolled_link_element *list_unrolled_locate(t_list *self, int index, int *offset) {
+	// Para index == elements_count retorna la posición siguiente al último
+	// elemento, que es donde se inserta al agregar al final
+	t_unrolled_link_element *node;
+	int first;
+	if (self->cursor_node != NULL && abs(index - self->cursor_index) <= index
+			&& abs(index - self->cursor_index) <= self->elements_count - index) {
+		node = self->cursor_node;
+		first = self->cursor_index;
+	} else if (index > self->elements_count / 2) {
+		node = self->unrolled_tail;
+		first = self->elements_count - (node != NULL ? node->count : 0);
+	} else {
+		node = self->unrolled_head;
+		first = 0;
+	}
+
+	while (node != NULL && index < first) {
+		node = node->previous;
+		first -= node->count;
+	}
+	while (node != NULL && index >= first + node->count && node->next != NULL) {
+		first += node->count;
+		node = node->next;
+	}
+	if (node != NULL && index >= first + node->count && index != self->elements_count) {
+		node = NULL;
+	}
+
+	if (node != NULL) {
+		self->cursor_node = node;
+		self->cursor_index = first;
+	}
+	*offset = index - first;
+	return node;
+}
+
+static t_unrolled_link_element *list_unrolled_find(t_list *self, bool(*condition)(void*), int *offset) {
+	for (t_unrolled_link_element *node = self->unrolled_head; node != NULL; node = node->next) {
+		for (int i = 0; i < node->count; i++) {
+			if (condition(node->data[i])) {
+				*offset = i;
+				return node;
+			}
+		}
+	}
+	return NULL;
+}
+
+static void list_unrolled_insert(t_list *self, t_unrolled_link_element **node, int *offset, void *data) {
+	t_unrolled_link_element *target = *node;
+	int position = *offset;
+
+	if (target != self->cursor_node) {
+		list_invalidate_cursor(self);
+	}
+	if (target == NULL) {
+		target = list_unrolled_create_node(self, self->unrolled_tail);
+		position = 0;
+	} else if (target->count == UNROLLED_LINK_ELEMENT_CAPACITY) {
+		int half = UNROLLED_LINK_ELEMENT_CAPACITY / 2;
+		if (position == UNROLLED_LINK_ELEMENT_CAPACITY) {
+			target = list_unrolled_create_node(self, target);
+			position = 0;
+		} else if (position == 0 && target->previous != NULL && target->previous->count < UNROLLED_LINK_ELEMENT_CAPACITY) {
+			target = target->previous;
+			position = target->count;
+		} else {
+			// El nodo lleno se parte a la mitad para hacerle lugar al elemento
+			t_unrolled_link_element *second = list_unrolled_create_node(self, target);
+			memcpy(second->data, target->data + half, (UNROLLED_LINK_ELEMENT_CAPACITY - half) * sizeof(void*));
+			second->count = UNROLLED_LINK_ELEMENT_CAPACITY - half;
+			target->count = half;
+			if (position > half) {
+				target = second;
+				position -= half;
+			}
+		}
+	}
+
+	if (target != self->cursor_node) {
+		list_invalidate_cursor(self);
+	}
+	memmove(target->data + position + 1, target->data + position, (target->count - position) * sizeof(void*));
+	target->data[position] = data;
+	target->count++;
+	self->elements_count++;
+
+	*node = target;
+	*offset = position;
+}
+
+static void *list_unrolled_remove(t_list *self, t_unrolled_link_element **node, int *offset) {
+	// Deja en node y offset la posición del elemento que seguía al quitado
+	t_unrolled_link_element *target = *node;
+	int position = *offset;
+	void *data = target->data[position];
+	if (target != self->cursor_node) {
+		list_invalidate_cursor(self);
+	}
+
+	memmove(target->data + position, target->data + position + 1, (target->count - position - 1) * sizeof(void*));
+	target->count--;
+	self->elements_count--;
+
+	if (target->count == 0) {
+		*node = target->next;
+		*offset = 0;
+		list_unrolled_destroy_node(self, target);
+		return data;
+	}
+
+	// Un nodo que queda a menos de la mitad se fusiona con un vecino si
+	// entran en un solo nodo, para que los recorridos no pierdan densidad
+	// después de muchas eliminaciones
+	t_unrolled_link_element *next = target->next;
+	t_unrolled_link_element *previous = target->previous;
+	if (target->count < UNROLLED_LINK_ELEMENT_CAPACITY / 2) {
+		if (next != NULL && target->count + next->count <= UNROLLED_LINK_ELEMENT_CAPACITY) {
+			memcpy(target->data + target->count, next->data, next->count * sizeof(void*));
+			target->count += next->count;
+			list_unrolled_destroy_node(self, next);
+		} else if (previous != NULL && previous->count + target->count <= UNROLLED_LINK_ELEMENT_CAPACITY) {
+			memcpy(previous->data + previous->count, target->data, target->count * sizeof(void*));
+			position += previous->count;
+			previous->count += target->count;
+			list_unrolled_destroy_node(self, target);
+			target = previous;
+		}
+	}
+
+	if (position == target->count) {
+		*node = target->next;
+		*offset = 0;
+	} else {
+		*node = target;
+		*offset = position;
+	}
+	return data;
+}
+
+static void list_unrolled_advance(t_unrolled_link_element **node, int *offset) {
+	if (++(*offset) == (*node)->count) {
+		*node = (*node)->next;
+		*offset = 0;
+	}
+}
+
+static void list_unrolled_clean(t_list *self) {
+	t_unrolled_link_element *node = self->unrolled_head;
+	while (node != NULL) {
+		t_unrolled_link_element *next = node->next;
+		free(node);
+		node = next;
+	}
+	self->unrolled_head = NULL;
+	self->unrolled_tail = NULL;
+	self->elements_count = 0;
+	list_invalidate_cursor(self);
+}
+
+static void list_unrolled_sort(t_list *self, bool (*comparator)(void*,void*)) {
+	// Mergesort estable sobre una copia contigua de los elementos, que luego
+	// se vuelven a escribir en los mismos nodos
+	int count = self->elements_count;
+	void **elements = malloc(count * sizeof(void*));
+	void **buffer = malloc(count * sizeof(void*));
+	int index = 0;
+	for (t_unrolled_link_element *node = self->unrolled_head; node != NULL; node = node->next) {
+		memcpy(elements + index, node->data, node->count * sizeof(void*));
+		index += node->count;
+	}
+
+	void **from = elements;
+	void **to = buffer;
+	for (int width = 1; width < count; width *= 2) {
+		for (int left = 0; left < count; left += 2 * width) {
+			int middle = left + width < count ? left + width : count;
+			int right = left + 2 * width < count ? left + 2 * width : count;
+			int i = left, j = middle, k = left;
+			while (i < middle && j < right) {
+				to[k++] = comparator(from[i], from[j]) ? from[i++] : from[j++];
+			}
+			while (i < middle) {
+				to[k++] = from[i++];
+			}
+			while (j < right) {
+				to[k++] = from[j++];
+			}
+		}
+		void **merged = to;
+		to = from;
+		from = merged;
+	}
+
+	index = 0;
+	for (t_unrolled_link_element *node = self->unrolled_head; node != NULL; node = node->next) {
+		memcpy(node->data, from + index, node->count * sizeof(void*));
+		index += node->count;
+	}
+	free(elements);
+	free(buffer);
+}
+
+static t_list_position list_position_first(t_list *self) {
+	return (t_list_position) { .element = self->head, .node = self->unrolled_head, .offset = 0 };
+}
+
+static void *list_position_data(t_list_position *position) {
+	return position->node != NULL ? position->node->data[position->offset] : position->element->data;
+}
+
+static void list_position_advance(t_list_position *position) {
+	if (position->node != NULL) {
+		list_unrolled_advance(&position->node, &position->offset);
+	} else {
+		position->element = position->element->next;
+	}
+}
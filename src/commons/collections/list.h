@@ -18,8 +18,12 @@
 #define LIST_H_
 
 	#include "node.h"
+	#include "node_pool.h"
 	#include <stdbool.h>
 
+	// Definido en commons/threadpool.h, usado por las operaciones paralelas
+	typedef struct t_threadpool t_threadpool;
+
 	/**
 	 * @file
 	 * @brief `#include <commons/collections/list.h>`
@@ -31,7 +35,17 @@
 	 */
 	typedef struct {
 		t_link_element *head;
+		t_link_element **tail;
 		int elements_count;
+		t_node_pool *pool;
+		bool unrolled;
+		t_unrolled_link_element *unrolled_head;
+		t_unrolled_link_element *unrolled_tail;
+		// Última posición accedida por índice, desde donde continúan los
+		// accesos siguientes. NULL si alguna modificación la invalidó.
+		t_link_element **cursor;
+		t_unrolled_link_element *cursor_node;
+		int cursor_index;
 	} t_list;
 
 	/**
@@ -43,6 +57,10 @@
 		t_link_element **actual;
 		t_link_element **next;
 		int index;
+		t_unrolled_link_element *actual_node;
+		int actual_offset;
+		t_unrolled_link_element *next_node;
+		int next_offset;
 	} t_list_iterator;
 
 	/**
@@ -62,6 +80,42 @@
 	 */
 	t_list * list_create(void);
 
+	/**
+	 * @brief Crea una lista que obtiene sus nodos del pool recibido por
+	 *        parámetro en lugar de reservarlos con `malloc()`
+	 * @param pool: Pool creado con `node_pool_create()` con un tamaño de nodo
+	 *              de al menos `sizeof(t_link_element)`. Puede ser compartido
+	 *              por varias listas de un mismo hilo y debe destruirse
+	 *              después que ellas.
+	 * @return Retorna un puntero a la lista creada, liberable de la misma
+	 *         forma que una creada con `list_create()`
+	 *
+	 * @note Las listas que se obtengan a partir de ésta (por ejemplo con
+	 *       `list_filter()`, `list_map()` o `list_slice()`) usarán el mismo pool.
+	 */
+	t_list * list_create_with_pool(t_node_pool *pool);
+
+	/**
+	 * @brief Crea una lista desenrollada: en lugar de un nodo por elemento,
+	 *        cada nodo guarda hasta UNROLLED_LINK_ELEMENT_CAPACITY elementos
+	 *        contiguos, por lo que recorrerla provoca muchos menos fallos de
+	 *        caché y agregar al final reserva memoria una vez cada
+	 *        UNROLLED_LINK_ELEMENT_CAPACITY elementos.
+	 * @return Retorna un puntero a la lista creada, que se usa y libera con
+	 *         las mismas funciones que una creada con `list_create()`
+	 *
+	 * @note Las listas que se obtengan a partir de ésta (por ejemplo con
+	 *       `list_filter()`, `list_map()` o `list_slice()`) también serán
+	 *       desenrolladas.
+	 *
+	 * Ejemplo de uso:
+	 * @code
+	 * t_list* frames = list_create_unrolled();
+	 * list_add(frames, frame);
+	 * @endcode
+	 */
+	t_list * list_create_unrolled(void);
+
 	/**
 	* @brief Agrega un elemento al final de la lista
 	* @param element: El elemento a agregar. Este elemento pasará a pertenecer
@@ -212,6 +266,11 @@
 	*         perteneciendo a la lista, por lo que no debe ser liberado por fuera
 	*         de ésta.
 	*
+	* @note La lista recuerda la última posición accedida por índice, por lo
+	*       que recorrerla con `list_get(list, i)` para i creciente es O(n) en
+	*       total. Como esto modifica la lista, no debe llamarse desde varios
+	*       hilos a la vez sin sincronizarlos.
+	*
 	* Ejemplo de uso:
 	* @code
 	* t_list* people = list_create();
@@ -395,6 +454,24 @@
 	*/
 	t_list* list_filter(t_list* self, bool(*condition)(void*));
 
+	/**
+	* @brief Igual que `list_filter()`, pero evaluando la condición en paralelo
+	*        sobre porciones de la lista en los hilos de `threads`.
+	* @return Una nueva lista con los elementos que cumplen la condición, en el
+	*         mismo orden que en la lista original.
+	*
+	* @note La condición es llamada desde varios hilos a la vez, por lo que no
+	*       debe modificar estado compartido sin sincronizarlo. Para listas
+	*       chicas o condiciones baratas, `list_filter()` suele ser más rápida.
+	*
+	* Ejemplo de uso:
+	* @code
+	* t_threadpool* threads = threadpool_create(0);
+	* t_list* dirty_pages = list_parallel_filter(pages, threads, _is_dirty);
+	* @endcode
+	*/
+	t_list* list_parallel_filter(t_list* self, t_threadpool* threads, bool(*condition)(void*));
+
 	/**
 	* @brief Retorna una nueva lista con los elementos transformados
 	* @return Los elementos de la lista retornada seguirán perteneciendo a la lista original.
@@ -418,6 +495,23 @@
 	*/
 	t_list* list_map(t_list* self, void*(*transformer)(void*));
 
+	/**
+	* @brief Igual que `list_map()`, pero aplicando la transformación en
+	*        paralelo sobre porciones de la lista en los hilos de `threads`.
+	* @return Una nueva lista con los elementos transformados, en el mismo
+	*         orden que en la lista original.
+	*
+	* @note La transformación es llamada desde varios hilos a la vez, por lo
+	*       que no debe modificar estado compartido sin sincronizarlo.
+	*
+	* Ejemplo de uso:
+	* @code
+	* t_threadpool* threads = threadpool_create(0);
+	* t_list* checksums = list_parallel_map(pages, threads, _page_checksum);
+	* @endcode
+	*/
+	t_list* list_parallel_map(t_list* self, t_threadpool* threads, void*(*transformer)(void*));
+
 	/**
 	 * @brief Retorna una nueva lista con los elementos de la lista de listas
 	 *        recibida.
@@ -800,6 +894,9 @@
 	*                    true si el primer parametro debe aparecer antes que el
 	*                    segundo en la lista
 	*
+	* @note El ordenamiento se realiza en O(n log n) reenlazando los nodos
+	*       existentes, por lo que no reserva memoria.
+	*
 	* Ejemplo de uso:
 	* @code
 	* t_list* people = list_create();
@@ -1008,6 +1105,28 @@
 	 */
 	void* list_fold1(t_list* self, void* (*operation)(void*, void*));
 
+	/**
+	 * @brief Igual que `list_fold()`, pero reduciendo en paralelo porciones
+	 *        de la lista en los hilos de `threads` y combinando luego sus
+	 *        resultados en orden.
+	 * @param operation: Funcion asociativa que recibe dos valores del tipo de
+	 *        los elementos de la lista y devuelve otro valor del mismo tipo.
+	 *        Al igual que en `list_fold1()`, se aplica entre elementos y
+	 *        resultados parciales, por lo que la semilla también debe ser de
+	 *        ese tipo.
+	 * @return El resultado de aplicar la operación a la semilla y a todos los
+	 *         elementos, o la semilla si la lista está vacía.
+	 *
+	 * Ejemplo de uso:
+	 * @code
+	 * void* _sum(void* a, void* b) {
+	 *     return (void*) ((intptr_t) a + (intptr_t) b);
+	 * }
+	 * intptr_t total = (intptr_t) list_parallel_fold(sizes, threads, 0, _sum);
+	 * @endcode
+	 */
+	void* list_parallel_fold(t_list* self, t_threadpool* threads, void* seed, void*(*operation)(void*, void*));
+
 	/**
 	 * @brief Inicializa una iteración externa de la lista. Permite recorrer
 	 *        la lista y modificarla al mismo tiempo. En caso de
@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include "mpmc_queue.h"
+
+/*
+ * Algoritmo de cola acotada de Dmitry Vyukov. La posición i del arreglo
+ * tiene secuencia:
+ *   - pos,            si está libre para el productor que obtenga pos.
+ *   - pos + 1,        si tiene el elemento para el consumidor que obtenga pos.
+ *   - pos + capacity, una vez consumida, libre para la siguiente vuelta.
+ * Un hilo que ve la secuencia esperada intenta reservar la posición con un
+ * compare-and-swap; si otro se le adelantó, reintenta con la siguiente.
+ */
+
+static void mpmc_queue_wait(t_mpmc_queue *self, _Atomic uint32_t *events, atomic_int *waiting, bool(*try_operation)(t_mpmc_queue*, void**), void **element);
+static bool mpmc_queue_try_push_element(t_mpmc_queue *self, void **element);
+static void mpmc_queue_notify(_Atomic uint32_t *events, atomic_int *waiting);
+static void mpmc_queue_futex(_Atomic uint32_t *address, int operation, uint32_t value);
+
+t_mpmc_queue *mpmc_queue_create(int capacity) {
+	size_t buffer_size = 2;
+	while (buffer_size < (size_t) capacity) {
+		buffer_size *= 2;
+	}
+
+	t_mpmc_queue *self = aligned_alloc(MPMC_QUEUE_CACHE_LINE_SIZE, sizeof(t_mpmc_queue));
+	self->buffer = malloc(buffer_size * sizeof(t_mpmc_cell));
+	self->mask = buffer_size - 1;
+	for (size_t i = 0; i < buffer_size; i++) {
+		atomic_init(&self->buffer[i].sequence, i);
+	}
+	atomic_init(&self->enqueue_position, 0);
+	atomic_init(&self->dequeue_position, 0);
+	atomic_init(&self->push_events, 0);
+	atomic_init(&self->pop_events, 0);
+	atomic_init(&self->waiting_consumers, 0);
+	atomic_init(&self->waiting_producers, 0);
+	return self;
+}
+
+bool mpmc_queue_try_push(t_mpmc_queue *self, void *element) {
+	t_mpmc_cell *cell;
+	size_t position = atomic_load_explicit(&self->enqueue_position, memory_order_relaxed);
+
+	while (true) {
+		cell = &self->buffer[position & self->mask];
+		size_t sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+		intptr_t difference = (intptr_t) sequence - (intptr_t) position;
+
+		if (difference == 0) {
+			if (atomic_compare_exchange_weak_explicit(&self->enqueue_position, &position, position + 1,
+					memory_order_relaxed, memory_order_relaxed)) {
+				break;
+			}
+		} else if (difference < 0) {
+			return false;
+		} else {
+			position = atomic_load_explicit(&self->enqueue_position, memory_order_relaxed);
+		}
+	}
+
+	cell->data = element;
+	atomic_store_explicit(&cell->sequence, position + 1, memory_order_release);
+	return true;
+}
+
+bool mpmc_queue_try_pop(t_mpmc_queue *self, void **element) {
+	t_mpmc_cell *cell;
+	size_t position = atomic_load_explicit(&self->dequeue_position, memory_order_relaxed);
+
+	while (true) {
+		cell = &self->buffer[position & self->mask];
+		size_t sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+		intptr_t difference = (intptr_t) sequence - (intptr_t) (position + 1);
+
+		if (difference == 0) {
+			if (atomic_compare_exchange_weak_explicit(&self->dequeue_position, &position, position + 1,
+					memory_order_relaxed, memory_order_relaxed)) {
+				break;
+			}
+		} else if (difference < 0) {
+			return false;
+		} else {
+			position = atomic_load_explicit(&self->dequeue_position, memory_order_relaxed);
+		}
+	}
+
+	*element = cell->data;
+	atomic_store_explicit(&cell->sequence, position + self->mask + 1, memory_order_release);
+	return true;
+}
+
+void mpmc_queue_push(t_mpmc_queue *self, void *element) {
+	mpmc_queue_wait(self, &self->pop_events, &self->waiting_producers, mpmc_queue_try_push_element, &element);
+	mpmc_queue_notify(&self->push_events, &self->waiting_consumers);
+}
+
+void *mpmc_queue_pop(t_mpmc_queue *self) {
+	void *element;
+	mpmc_queue_wait(self, &self->push_events, &self->waiting_consumers, mpmc_queue_try_pop, &element);
+	mpmc_queue_notify(&self->pop_events, &self->waiting_producers);
+	return element;
+}
+
+int mpmc_queue_size(t_mpmc_queue *self) {
+	size_t dequeue_position = atomic_load(&self->dequeue_position);
+	size_t enqueue_position = atomic_load(&self->enqueue_position);
+	return enqueue_position > dequeue_position ? enqueue_position - dequeue_position : 0;
+}
+
+void mpmc_queue_destroy(t_mpmc_queue *self) {
+	free(self->buffer);
+	free(self);
+}
+
+void mpmc_queue_destroy_and_destroy_elements(t_mpmc_queue *self, void(*element_destroyer)(void*)) {
+	void *element;
+	while (mpmc_queue_try_pop(self, &element)) {
+		element_destroyer(element);
+	}
+	mpmc_queue_destroy(self);
+}
+
+/********* PRIVATE FUNCTIONS **************/
+
+static void mpmc_queue_wait(t_mpmc_queue *self, _Atomic uint32_t *events, atomic_int *waiting, bool(*try_operation)(t_mpmc_queue*, void**), void **element) {
+	// Se lee el contador de eventos antes de reintentar: si el evento que
+	// destraba la operación ocurre después, el contador ya no coincide y el
+	// futex no llega a dormir al hilo.
+	while (!try_operation(self, element)) {
+		uint32_t seen_events = atomic_load(events);
+		atomic_fetch_add(waiting, 1);
+		if (!try_operation(self, element)) {
+			mpmc_queue_futex(events, FUTEX_WAIT_PRIVATE, seen_events);
+			atomic_fetch_sub(waiting, 1);
+			continue;
+		}
+		atomic_fetch_sub(waiting, 1);
+		return;
+	}
+}
+
+static bool mpmc_queue_try_push_element(t_mpmc_queue *self, void **element) {
+	return mpmc_queue_try_push(self, *element);
+}
+
+static void mpmc_queue_notify(_Atomic uint32_t *events, atomic_int *waiting) {
+	atomic_fetch_add(events, 1);
+	if (atomic_load(waiting) > 0) {
+		mpmc_queue_futex(events, FUTEX_WAKE_PRIVATE, 1);
+	}
+}
+
+static void mpmc_queue_futex(_Atomic uint32_t *address, int operation, uint32_t value) {
+	syscall(SYS_futex, address, operation, value, NULL, NULL, 0);
+}
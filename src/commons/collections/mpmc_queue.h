@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MPMC_QUEUE_H_
+#define MPMC_QUEUE_H_
+
+	#define MPMC_QUEUE_CACHE_LINE_SIZE 64
+
+	#include <stdatomic.h>
+	#include <stdbool.h>
+	#include <stddef.h>
+	#include <stdint.h>
+
+	/**
+	 * @file
+	 * @brief `#include <commons/collections/mpmc_queue.h>`
+	 *
+	 * Cola de capacidad fija que puede ser usada por varios hilos productores
+	 * y consumidores a la vez sin mutex. Cada posición del arreglo circular
+	 * tiene un número de secuencia que indica si está libre para el próximo
+	 * productor o lista para el próximo consumidor, por lo que los hilos sólo
+	 * compiten por incrementar la posición de inserción o de extracción.
+	 *
+	 * A diferencia de `blocking_queue.h`, no tiene operación de cierre.
+	 */
+
+	/** @cond INCLUDE_INTERNALS */
+	typedef struct {
+		atomic_size_t sequence;
+		void *data;
+	} t_mpmc_cell;
+	/** @endcond */
+
+	/**
+	 * @struct t_mpmc_queue
+	 * @brief Cola de varios productores y consumidores. Inicializar con
+	 *        `mpmc_queue_create()`
+	 */
+	typedef struct {
+		_Alignas(MPMC_QUEUE_CACHE_LINE_SIZE) atomic_size_t enqueue_position;
+		_Alignas(MPMC_QUEUE_CACHE_LINE_SIZE) atomic_size_t dequeue_position;
+
+		_Alignas(MPMC_QUEUE_CACHE_LINE_SIZE) t_mpmc_cell *buffer;
+		size_t mask;
+
+		// Usados sólo por mpmc_queue_push() y mpmc_queue_pop() para dormir
+		// a los hilos que esperan lugar o elementos
+		_Alignas(MPMC_QUEUE_CACHE_LINE_SIZE) _Atomic uint32_t push_events;
+		atomic_int waiting_consumers;
+		_Alignas(MPMC_QUEUE_CACHE_LINE_SIZE) _Atomic uint32_t pop_events;
+		atomic_int waiting_producers;
+	} t_mpmc_queue;
+
+	/**
+	 * @brief Crea una cola de varios productores y consumidores
+	 * @param capacity: Cantidad máxima de elementos en espera. Se redondea
+	 *                  hacia arriba a una potencia de 2, con un mínimo de 2.
+	 * @return Retorna un puntero a la cola creada, liberable con
+	 *         `mpmc_queue_destroy()` o `mpmc_queue_destroy_and_destroy_elements()`
+	 *         una vez que ningún hilo la usa.
+	 */
+	t_mpmc_queue *mpmc_queue_create(int capacity);
+
+	/**
+	 * @brief Agrega un elemento al final de la cola, sin esperar.
+	 * @return false si la cola está llena.
+	 */
+	bool mpmc_queue_try_push(t_mpmc_queue *, void *element);
+
+	/**
+	 * @brief Quita el primer elemento de la cola, sin esperar.
+	 * @param[out] element Donde se guarda el elemento extraído.
+	 * @return false si la cola está vacía.
+	 */
+	bool mpmc_queue_try_pop(t_mpmc_queue *, void **element);
+
+	/**
+	 * @brief Agrega un elemento al final de la cola. Si está llena, el hilo
+	 *        duerme hasta que algún consumidor libere un lugar.
+	 */
+	void mpmc_queue_push(t_mpmc_queue *, void *element);
+
+	/**
+	 * @brief Quita el primer elemento de la cola. Si está vacía, el hilo
+	 *        duerme hasta que algún productor agregue un elemento.
+	 */
+	void *mpmc_queue_pop(t_mpmc_queue *);
+
+	/**
+	 * @brief Retorna la cantidad aproximada de elementos en espera.
+	 * @note Con otros hilos usando la cola, el valor puede estar
+	 *       desactualizado al momento de usarlo.
+	 */
+	int mpmc_queue_size(t_mpmc_queue *);
+
+	/**
+	 * @brief Destruye la cola sin liberar los elementos que contiene
+	 */
+	void mpmc_queue_destroy(t_mpmc_queue *);
+
+	/**
+	 * @brief Destruye la cola, liberando los elementos que contiene con
+	 *        `element_destroyer`
+	 */
+	void mpmc_queue_destroy_and_destroy_elements(t_mpmc_queue *, void(*element_destroyer)(void*));
+
+#endif /* MPMC_QUEUE_H_ */
@@ -32,13 +32,22 @@
 	};
 	typedef struct double_link_element t_double_link_element;
 
-	struct hash_element{
+	#define UNROLLED_LINK_ELEMENT_CAPACITY 32
+
+	struct unrolled_link_element{
+		struct unrolled_link_element *previous;
+		struct unrolled_link_element *next;
+		int count;
+		void *data[UNROLLED_LINK_ELEMENT_CAPACITY];
+	};
+	typedef struct unrolled_link_element t_unrolled_link_element;
+
+	struct hash_slot{
 		char *key;
 		unsigned int hashcode;
 		void *data;
-		struct hash_element *next;
 	};
-	typedef struct hash_element t_hash_element;
+	typedef struct hash_slot t_hash_slot;
 
 	/** @endcond */
 
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+
+#include "node_pool.h"
+
+typedef union slab_header {
+	union slab_header *next;
+	max_align_t alignment;
+} t_slab_header;
+
+typedef struct free_node {
+	struct free_node *next;
+} t_free_node;
+
+static void node_pool_refill(t_node_pool *self, int amount);
+
+t_node_pool *node_pool_create(size_t node_size, int nodes_per_slab) {
+	t_node_pool *self = malloc(sizeof(t_node_pool));
+	size_t alignment = sizeof(void*);
+	if (node_size < sizeof(t_free_node)) {
+		node_size = sizeof(t_free_node);
+	}
+	self->node_size = (node_size + alignment - 1) / alignment * alignment;
+	self->nodes_per_slab = nodes_per_slab > 0 ? nodes_per_slab : DEFAULT_NODE_POOL_SLAB_SIZE;
+	self->slabs = NULL;
+	self->free_nodes = NULL;
+	self->stats = (t_node_pool_stats) {0};
+	return self;
+}
+
+void *node_pool_alloc(t_node_pool *self) {
+	if (self->free_nodes == NULL) {
+		node_pool_refill(self, self->nodes_per_slab);
+	}
+	t_free_node *node = self->free_nodes;
+	self->free_nodes = node->next;
+
+	self->stats.nodes_available--;
+	self->stats.nodes_in_use++;
+	self->stats.allocations++;
+	return node;
+}
+
+void node_pool_reserve(t_node_pool *self, int nodes) {
+	if (nodes > self->stats.nodes_available) {
+		node_pool_refill(self, nodes - self->stats.nodes_available);
+	}
+}
+
+void node_pool_free(t_node_pool *self, void *node) {
+	t_free_node *free_node = node;
+	free_node->next = self->free_nodes;
+	self->free_nodes = free_node;
+
+	self->stats.nodes_in_use--;
+	self->stats.nodes_available++;
+	self->stats.releases++;
+}
+
+t_node_pool_stats node_pool_get_stats(t_node_pool *self) {
+	return self->stats;
+}
+
+void node_pool_destroy(t_node_pool *self) {
+	t_slab_header *slab = self->slabs;
+	while (slab != NULL) {
+		t_slab_header *next = slab->next;
+		free(slab);
+		slab = next;
+	}
+	free(self);
+}
+
+/********* PRIVATE FUNCTIONS **************/
+
+static void node_pool_refill(t_node_pool *self, int amount) {
+	t_slab_header *slab = malloc(sizeof(t_slab_header) + self->node_size * amount);
+	slab->next = self->slabs;
+	self->slabs = slab;
+
+	char *nodes = (char*) (slab + 1);
+	for (int i = amount - 1; i >= 0; i--) {
+		t_free_node *node = (t_free_node*) (nodes + i * self->node_size);
+		node->next = self->free_nodes;
+		self->free_nodes = node;
+	}
+
+	self->stats.slabs++;
+	self->stats.nodes_available += amount;
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NODE_POOL_H_
+#define NODE_POOL_H_
+
+	#define DEFAULT_NODE_POOL_SLAB_SIZE 256
+
+	#include <stddef.h>
+
+	/**
+	 * @file
+	 * @brief `#include <commons/collections/node_pool.h>`
+	 *
+	 * Pool de nodos de tamaño fijo. Reserva la memoria de a bloques (slabs) y
+	 * reutiliza los nodos liberados, evitando un `malloc()` y un `free()` por
+	 * cada elemento agregado o quitado de una colección.
+	 *
+	 * @warning El pool no utiliza semáforos: si varios hilos usan colecciones,
+	 *          cada hilo debe tener su propio pool.
+	 */
+
+	/**
+	 * @struct t_node_pool_stats
+	 * @brief Contadores de uso de un pool de nodos
+	 */
+	typedef struct {
+		int slabs;            //!< Cantidad de bloques reservados
+		int nodes_in_use;     //!< Nodos entregados y todavía no devueltos
+		int nodes_available;  //!< Nodos libres listos para ser reutilizados
+		long allocations;     //!< Total de nodos entregados por el pool
+		long releases;        //!< Total de nodos devueltos al pool
+	} t_node_pool_stats;
+
+	/**
+	 * @struct t_node_pool
+	 * @brief Pool de nodos. Inicializar con `node_pool_create()`
+	 */
+	typedef struct {
+		size_t node_size;
+		int nodes_per_slab;
+		void *slabs;
+		void *free_nodes;
+		t_node_pool_stats stats;
+	} t_node_pool;
+
+	/**
+	 * @brief Crea un pool de nodos
+	 * @param node_size: Tamaño de cada nodo. Para usarlo con listas debe ser
+	 *                   al menos `sizeof(t_link_element)`.
+	 * @param nodes_per_slab: Cantidad de nodos a reservar cada vez que el pool
+	 *                        se queda sin nodos libres.
+	 * @return Retorna un puntero al pool creado, liberable con `node_pool_destroy()`
+	 *
+	 * Ejemplo de uso:
+	 * @code
+	 * t_node_pool* pool = node_pool_create(sizeof(t_link_element), DEFAULT_NODE_POOL_SLAB_SIZE);
+	 * t_list* ready = list_create_with_pool(pool);
+	 * t_list* blocked = list_create_with_pool(pool);
+	 * ...
+	 * list_destroy(ready);
+	 * list_destroy(blocked);
+	 * node_pool_destroy(pool);
+	 * @endcode
+	 */
+	t_node_pool *node_pool_create(size_t node_size, int nodes_per_slab);
+
+	/**
+	 * @brief Obtiene un nodo del pool, reservando un nuevo bloque si no quedan
+	 *        nodos libres.
+	 * @return Un nodo de `node_size` bytes sin inicializar, que debe ser devuelto
+	 *         con `node_pool_free()`.
+	 */
+	void *node_pool_alloc(t_node_pool *self);
+
+	/**
+	 * @brief Reserva de una sola vez los nodos necesarios para que haya al
+	 *        menos `nodes` nodos libres, por ejemplo antes de una carga masiva
+	 *        en una lista creada con `list_create_with_pool()`.
+	 */
+	void node_pool_reserve(t_node_pool *self, int nodes);
+
+	/**
+	 * @brief Devuelve un nodo al pool para que pueda ser reutilizado
+	 */
+	void node_pool_free(t_node_pool *self, void *node);
+
+	/**
+	 * @brief Retorna los contadores de uso del pool
+	 */
+	t_node_pool_stats node_pool_get_stats(t_node_pool *self);
+
+	/**
+	 * @brief Destruye el pool liberando todos sus bloques
+	 * @warning Las colecciones que usen el pool deben ser destruidas antes.
+	 */
+	void node_pool_destroy(t_node_pool *self);
+
+#endif /* NODE_POOL_H_ */
@@ -0,0 +1,183 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include "priority_queue.h"
+
+static int priority_queue_new_handle(t_priority_queue *self);
+static void priority_queue_grow(t_priority_queue *self);
+static void priority_queue_set_entry(t_priority_queue *self, int index, t_priority_queue_entry entry);
+static int priority_queue_sift_up(t_priority_queue *self, int index);
+static void priority_queue_sift_down(t_priority_queue *self, int index);
+static void *priority_queue_remove_index(t_priority_queue *self, int index);
+
+t_priority_queue *priority_queue_create(bool (*comparator)(void*, void*)) {
+	return priority_queue_create_with_arity(comparator, DEFAULT_PRIORITY_QUEUE_ARITY);
+}
+
+t_priority_queue *priority_queue_create_with_arity(bool (*comparator)(void*, void*), int arity) {
+	t_priority_queue *self = malloc(sizeof(t_priority_queue));
+	self->comparator = comparator;
+	self->arity = arity >= 2 ? arity : 2;
+	self->elements_count = 0;
+	self->capacity = DEFAULT_PRIORITY_QUEUE_INITIAL_CAPACITY;
+	self->entries = malloc(self->capacity * sizeof(t_priority_queue_entry));
+	self->positions = malloc(self->capacity * sizeof(int));
+	self->free_handles = malloc(self->capacity * sizeof(int));
+	self->free_handles_count = 0;
+	self->handles_count = 0;
+	return self;
+}
+
+int priority_queue_push(t_priority_queue *self, void *element) {
+	if (self->elements_count == self->capacity) {
+		priority_queue_grow(self);
+	}
+
+	int handle = priority_queue_new_handle(self);
+	int index = self->elements_count++;
+	priority_queue_set_entry(self, index, (t_priority_queue_entry) { .element = element, .handle = handle });
+	priority_queue_sift_up(self, index);
+	return handle;
+}
+
+void *priority_queue_pop(t_priority_queue *self) {
+	return self->elements_count > 0 ? priority_queue_remove_index(self, 0) : NULL;
+}
+
+void *priority_queue_peek(t_priority_queue *self) {
+	return self->elements_count > 0 ? self->entries[0].element : NULL;
+}
+
+void priority_queue_update(t_priority_queue *self, int handle) {
+	int index = self->positions[handle];
+	if (priority_queue_sift_up(self, index) == index) {
+		priority_queue_sift_down(self, index);
+	}
+}
+
+void *priority_queue_get(t_priority_queue *self, int handle) {
+	return self->entries[self->positions[handle]].element;
+}
+
+void *priority_queue_remove(t_priority_queue *self, int handle) {
+	return priority_queue_remove_index(self, self->positions[handle]);
+}
+
+int priority_queue_size(t_priority_queue *self) {
+	return self->elements_count;
+}
+
+bool priority_queue_is_empty(t_priority_queue *self) {
+	return self->elements_count == 0;
+}
+
+void priority_queue_destroy(t_priority_queue *self) {
+	free(self->entries);
+	free(self->positions);
+	free(self->free_handles);
+	free(self);
+}
+
+void priority_queue_destroy_and_destroy_elements(t_priority_queue *self, void(*element_destroyer)(void*)) {
+	for (int i = 0; i < self->elements_count; i++) {
+		element_destroyer(self->entries[i].element);
+	}
+	priority_queue_destroy(self);
+}
+
+/********* PRIVATE FUNCTIONS **************/
+
+static int priority_queue_new_handle(t_priority_queue *self) {
+	// Hay tantos handles como lugares en el heap, por lo que si no quedan
+	// handles liberados hay uno sin usar al final
+	if (self->free_handles_count > 0) {
+		return self->free_handles[--self->free_handles_count];
+	}
+	return self->handles_count++;
+}
+
+static void priority_queue_grow(t_priority_queue *self) {
+	self->capacity *= 2;
+	self->entries = realloc(self->entries, self->capacity * sizeof(t_priority_queue_entry));
+	self->positions = realloc(self->positions, self->capacity * sizeof(int));
+	self->free_handles = realloc(self->free_handles, self->capacity * sizeof(int));
+}
+
+static void priority_queue_set_entry(t_priority_queue *self, int index, t_priority_queue_entry entry) {
+	self->entries[index] = entry;
+	self->positions[entry.handle] = index;
+}
+
+static int priority_queue_sift_up(t_priority_queue *self, int index) {
+	t_priority_queue_entry entry = self->entries[index];
+
+	while (index > 0) {
+		int parent = (index - 1) / self->arity;
+		if (!self->comparator(entry.element, self->entries[parent].element)
+				|| self->comparator(self->entries[parent].element, entry.element)) {
+			break;
+		}
+		priority_queue_set_entry(self, index, self->entries[parent]);
+		index = parent;
+	}
+
+	priority_queue_set_entry(self, index, entry);
+	return index;
+}
+
+static void priority_queue_sift_down(t_priority_queue *self, int index) {
+	t_priority_queue_entry entry = self->entries[index];
+
+	while (true) {
+		int first_child = index * self->arity + 1;
+		if (first_child >= self->elements_count) {
+			break;
+		}
+
+		int last_child = first_child + self->arity;
+		if (last_child > self->elements_count) {
+			last_child = self->elements_count;
+		}
+		int best_child = first_child;
+		for (int child = first_child + 1; child < last_child; child++) {
+			if (self->comparator(self->entries[child].element, self->entries[best_child].element)) {
+				best_child = child;
+			}
+		}
+
+		if (self->comparator(entry.element, self->entries[best_child].element)) {
+			break;
+		}
+		priority_queue_set_entry(self, index, self->entries[best_child]);
+		index = best_child;
+	}
+
+	priority_queue_set_entry(self, index, entry);
+}
+
+static void *priority_queue_remove_index(t_priority_queue *self, int index) {
+	t_priority_queue_entry removed = self->entries[index];
+	self->free_handles[self->free_handles_count++] = removed.handle;
+
+	self->elements_count--;
+	if (index < self->elements_count) {
+		// El último elemento ocupa el lugar del quitado y se reubica
+		priority_queue_set_entry(self, index, self->entries[self->elements_count]);
+		priority_queue_update(self, self->entries[index].handle);
+	}
+	return removed.element;
+}
@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PRIORITY_QUEUE_H_
+#define PRIORITY_QUEUE_H_
+
+	#define DEFAULT_PRIORITY_QUEUE_ARITY 4
+	#define DEFAULT_PRIORITY_QUEUE_INITIAL_CAPACITY 16
+
+	#include <stdbool.h>
+
+	/**
+	 * @file
+	 * @brief `#include <commons/collections/priority_queue.h>`
+	 */
+
+	/** @cond INCLUDE_INTERNALS */
+	typedef struct {
+		void *element;
+		int handle;
+	} t_priority_queue_entry;
+	/** @endcond */
+
+	/**
+	 * @struct t_priority_queue
+	 * @brief Cola de prioridad. Inicializar con `priority_queue_create()`
+	 *
+	 * Los elementos se guardan en un heap de aridad d sobre un arreglo, por lo
+	 * que agregar o quitar el primer elemento es O(log n) y consultarlo es O(1).
+	 * Cada elemento agregado recibe un handle que permite reubicarlo o quitarlo
+	 * sin buscarlo.
+	 */
+	typedef struct {
+		t_priority_queue_entry *entries;
+		int elements_count;
+		int capacity;
+		int arity;
+		bool (*comparator)(void*, void*);
+		int *positions;
+		int *free_handles;
+		int free_handles_count;
+		int handles_count;
+	} t_priority_queue;
+
+	/**
+	 * @brief Crea una cola de prioridad
+	 * @param comparator: Retorna true si el primer elemento debe salir antes que
+	 *                    el segundo, igual que el comparador de `list_sort()`.
+	 * @return Retorna un puntero a la cola creada, liberable con:
+	 *         - `priority_queue_destroy()` si se quiere liberar la cola pero no
+	 *           los elementos que contiene.
+	 *         - `priority_queue_destroy_and_destroy_elements()` si se quiere
+	 *           liberar la cola con los elementos que contiene.
+	 *
+	 * @note A diferencia de `list_sort()`, no se garantiza el orden entre
+	 *       elementos con la misma prioridad.
+	 *
+	 * Ejemplo de uso:
+	 * @code
+	 * bool _shortest_burst(t_pcb* a, t_pcb* b) {
+	 *     return a->estimated_burst <= b->estimated_burst;
+	 * }
+	 * t_priority_queue* ready = priority_queue_create((void*) _shortest_burst);
+	 * ...
+	 * t_pcb* next = priority_queue_pop(ready);
+	 * @endcode
+	 */
+	t_priority_queue *priority_queue_create(bool (*comparator)(void*, void*));
+
+	/**
+	 * @brief Crea una cola de prioridad cuyo heap tiene `arity` hijos por nodo.
+	 *        Más hijos por nodo hacen al heap más bajo, abaratando agregar y
+	 *        reubicar elementos a cambio de más comparaciones al quitar.
+	 * @see priority_queue_create
+	 */
+	t_priority_queue *priority_queue_create_with_arity(bool (*comparator)(void*, void*), int arity);
+
+	/**
+	 * @brief Agrega un elemento a la cola
+	 * @return El handle del elemento, válido hasta que el elemento sea quitado
+	 *         de la cola. Puede ser reutilizado por elementos agregados después.
+	 */
+	int priority_queue_push(t_priority_queue *, void *element);
+
+	/**
+	 * @brief Quita el primer elemento según el comparador
+	 * @return El elemento extraído, o NULL si la cola está vacía.
+	 */
+	void *priority_queue_pop(t_priority_queue *);
+
+	/**
+	 * @brief Retorna el primer elemento según el comparador sin quitarlo
+	 * @return El primer elemento, o NULL si la cola está vacía.
+	 */
+	void *priority_queue_peek(t_priority_queue *);
+
+	/**
+	 * @brief Reubica el elemento de `handle` luego de que cambió su prioridad,
+	 *        por ejemplo al envejecer un proceso o reestimar su ráfaga.
+	 * @warning Modificar la prioridad de un elemento sin llamar a esta función
+	 *          deja a la cola en un estado inválido.
+	 */
+	void priority_queue_update(t_priority_queue *, int handle);
+
+	/**
+	 * @brief Retorna el elemento de `handle` sin quitarlo
+	 */
+	void *priority_queue_get(t_priority_queue *, int handle);
+
+	/**
+	 * @brief Quita el elemento de `handle`, esté donde esté en la cola
+	 * @return El elemento quitado
+	 */
+	void *priority_queue_remove(t_priority_queue *, int handle);
+
+	/**
+	 * @brief Retorna la cantidad de elementos de la cola
+	 */
+	int priority_queue_size(t_priority_queue *);
+
+	/**
+	 * @brief Retorna true si la cola está vacía
+	 */
+	bool priority_queue_is_empty(t_priority_queue *);
+
+	/**
+	 * @brief Destruye la cola sin liberar los elementos que contiene
+	 */
+	void priority_queue_destroy(t_priority_queue *);
+
+	/**
+	 * @brief Destruye la cola, liberando los elementos que contiene con
+	 *        `element_destroyer`
+	 */
+	void priority_queue_destroy_and_destroy_elements(t_priority_queue *, void(*element_destroyer)(void*));
+
+#endif /* PRIORITY_QUEUE_H_ */
@@ -15,50 +15,126 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 #include "queue.h"
 
+static void queue_copy_out(t_queue *self, void **elements, int count);
+static void queue_resize(t_queue *self, int new_capacity);
 
 t_queue *queue_create() {
+	return queue_create_with_capacity(DEFAULT_QUEUE_INITIAL_CAPACITY);
+}
+
+t_queue *queue_create_with_capacity(int capacity) {
 	t_queue* queue = malloc(sizeof(t_queue));
-	t_list* elements = list_create();
-	queue->elements = elements;
+	queue->buffer = NULL;
+	queue->head = 0;
+	queue->elements_count = 0;
+	queue->capacity = 0;
+	queue_reserve(queue, capacity > 0 ? capacity : 1);
 	return queue;
 }
 
+void queue_reserve(t_queue *self, int capacity) {
+	if (capacity <= self->capacity) {
+		return;
+	}
+
+	int new_capacity = self->capacity > 0 ? self->capacity : 1;
+	while (new_capacity < capacity) {
+		new_capacity *= 2;
+	}
+	queue_resize(self, new_capacity);
+}
+
 void queue_clean(t_queue *self) {
-	list_clean(self->elements);
+	queue_clean_and_destroy_elements(self, NULL);
 }
 
 void queue_clean_and_destroy_elements(t_queue *self, void(*element_destroyer)(void*)) {
-	list_clean_and_destroy_elements(self->elements, element_destroyer);
+	if (element_destroyer != NULL) {
+		for (int i = 0; i < self->elements_count; i++) {
+			element_destroyer(self->buffer[(self->head + i) & (self->capacity - 1)]);
+		}
+	}
+	self->head = 0;
+	self->elements_count = 0;
 }
 
 void queue_destroy(t_queue *self) {
-	list_destroy(self->elements);
+	free(self->buffer);
 	free(self);
 }
 
 void queue_destroy_and_destroy_elements(t_queue *self, void(*element_destroyer)(void*)) {
-	list_destroy_and_destroy_elements(self->elements, element_destroyer);
-	free(self);
+	queue_clean_and_destroy_elements(self, element_destroyer);
+	queue_destroy(self);
 }
 
 void queue_push(t_queue *self, void *element) {
-	list_add(self->elements, element);
+	if (self->elements_count == self->capacity) {
+		queue_resize(self, self->capacity * 2);
+	}
+	self->buffer[(self->head + self->elements_count) & (self->capacity - 1)] = element;
+	self->elements_count++;
+}
+
+void queue_push_batch(t_queue *self, void **elements, int count) {
+	queue_reserve(self, self->elements_count + count);
+
+	// Los elementos pueden quedar partidos entre el final y el principio del arreglo
+	int tail = (self->head + self->elements_count) & (self->capacity - 1);
+	int until_end = self->capacity - tail < count ? self->capacity - tail : count;
+	memcpy(self->buffer + tail, elements, until_end * sizeof(void*));
+	memcpy(self->buffer, elements + until_end, (count - until_end) * sizeof(void*));
+	self->elements_count += count;
 }
 
 void *queue_pop(t_queue *self) {
-	return list_remove(self->elements, 0);
+	if (self->elements_count == 0) {
+		return NULL;
+	}
+	void *element = self->buffer[self->head];
+	self->head = (self->head + 1) & (self->capacity - 1);
+	self->elements_count--;
+	return element;
+}
+
+int queue_pop_batch(t_queue *self, void **elements, int max_count) {
+	int count = self->elements_count < max_count ? self->elements_count : max_count;
+	queue_copy_out(self, elements, count);
+	self->head = (self->head + count) & (self->capacity - 1);
+	self->elements_count -= count;
+	return count;
 }
 
 void *queue_peek(t_queue *self) {
-	return list_get(self->elements, 0);
+	return self->elements_count > 0 ? self->buffer[self->head] : NULL;
 }
 
 int queue_size(t_queue* self) {
-	return list_size(self->elements);
+	return self->elements_count;
 }
 
 bool queue_is_empty(t_queue *self) {
-	return list_is_empty(self->elements);
+	return self->elements_count == 0;
+}
+
+/********* PRIVATE FUNCTIONS **************/
+
+static void queue_copy_out(t_queue *self, void **elements, int count) {
+	int until_end = self->capacity - self->head < count ? self->capacity - self->head : count;
+	memcpy(elements, self->buffer + self->head, until_end * sizeof(void*));
+	memcpy(elements + until_end, self->buffer, (count - until_end) * sizeof(void*));
+}
+
+static void queue_resize(t_queue *self, int new_capacity) {
+	void **buffer = malloc(new_capacity * sizeof(void*));
+	if (self->buffer != NULL) {
+		queue_copy_out(self, buffer, self->elements_count);
+		free(self->buffer);
+	}
+	self->buffer = buffer;
+	self->head = 0;
+	self->capacity = new_capacity;
 }
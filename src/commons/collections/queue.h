@@ -17,6 +17,8 @@
 #ifndef QUEUE_H_
 #define QUEUE_H_
 
+	#define DEFAULT_QUEUE_INITIAL_CAPACITY 16
+
 	#include "list.h"
 
 	/**
@@ -27,9 +29,16 @@
 	/**
 	 * @struct t_queue
 	 * @brief Estructura que representa una cola. Inicializar con `queue_create()`
+	 *
+	 * Los elementos se guardan en un arreglo circular cuya capacidad es
+	 * siempre una potencia de 2 y se duplica cuando se llena, por lo que
+	 * agregar o quitar un elemento no reserva ni libera memoria.
 	 */
 	typedef struct {
-		t_list* elements;
+		void **buffer;
+		int head;
+		int elements_count;
+		int capacity;
 	} t_queue;
 
 	/**
@@ -42,6 +51,19 @@
 	*/
 	t_queue *queue_create(void);
 
+	/**
+	* @brief Crea una cola con lugar para al menos `capacity` elementos sin
+	*        necesidad de agrandarla.
+	* @see queue_create
+	*/
+	t_queue *queue_create_with_capacity(int capacity);
+
+	/**
+	* @brief Agranda la cola, si hace falta, para que entren al menos
+	*        `capacity` elementos sin volver a agrandarla.
+	*/
+	void queue_reserve(t_queue *, int capacity);
+
 	/**
 	* @brief Destruye una cola sin liberar los elementos que contiene
 	*/
@@ -60,17 +82,34 @@
 	*/
 	void queue_push(t_queue *, void *element);
 
+	/**
+	* @brief Agrega `count` elementos al final de la cola, en el orden en el
+	*        que están en el arreglo `elements`.
+	* @param elements Arreglo con los elementos a agregar. Los elementos pasarán
+	*                 a pertenecer a la cola, pero no así el arreglo.
+	*/
+	void queue_push_batch(t_queue *, void **elements, int count);
+
 	/**
 	* @brief quita el primer elemento de la cola
-	* @return El elemento extraído de la cola. Este elemento debe ser liberado
-	*         una vez que se deje de usar.
+	* @return El elemento extraído de la cola, o NULL si está vacía. Este
+	*         elemento debe ser liberado una vez que se deje de usar.
 	*/
 	void *queue_pop(t_queue *);
 
+	/**
+	* @brief Quita hasta `max_count` elementos del principio de la cola,
+	*        guardándolos en orden en el arreglo `elements`.
+	* @param elements Arreglo con lugar para al menos `max_count` elementos.
+	* @return La cantidad de elementos extraídos, que es menor a `max_count`
+	*         si la cola tenía menos elementos.
+	*/
+	int queue_pop_batch(t_queue *, void **elements, int max_count);
+
 	/**
 	* @brief Devuelve el primer elemento de la cola sin extraerlo
-	* @return El primer elemento de la cola. Este elemento no debe ser liberado
-	*         ya que seguirá perteneciendo a la cola.
+	* @return El primer elemento de la cola, o NULL si está vacía. Este elemento
+	*         no debe ser liberado ya que seguirá perteneciendo a la cola.
 	*/
 	void *queue_peek(t_queue *);
 
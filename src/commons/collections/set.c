@@ -0,0 +1,328 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "set.h"
+
+static t_set *set_create_internal(bool strings, int capacity);
+static uint64_t set_hash_number(uint64_t number);
+static uint64_t set_hash_string(char *string);
+static t_set_slot set_probe_string(char *string);
+static t_set_slot set_probe_number(uint64_t number);
+static bool set_add_slot(t_set *self, t_set_slot probe);
+static bool set_remove_slot(t_set *self, t_set_slot probe);
+static int set_find_index(t_set *self, t_set_slot *probe);
+static void set_insert_unique(t_set *self, t_set_slot *slot);
+static void set_insert_copy(t_set *self, t_set_slot *slot);
+static void set_copy_all(t_set *self, t_set *source);
+static void set_table_create(t_set *self, int capacity);
+static void set_resize(t_set *self, int new_max_size);
+static void set_remove_index(t_set *self, int index);
+static bool set_is_between(int index, int from, int to);
+
+t_set *set_create() {
+	return set_create_internal(true, DEFAULT_SET_INITIAL_SIZE);
+}
+
+t_set *set_create_int() {
+	return set_create_internal(false, DEFAULT_SET_INITIAL_SIZE);
+}
+
+void set_reserve(t_set *self, int capacity) {
+	if (capacity * 4 > self->table_max_size * 3) {
+		set_resize(self, capacity);
+	}
+}
+
+bool set_add(t_set *self, char *element) {
+	return set_add_slot(self, set_probe_string(element));
+}
+
+bool set_contains(t_set *self, char *element) {
+	t_set_slot probe = set_probe_string(element);
+	return set_find_index(self, &probe) != -1;
+}
+
+bool set_remove(t_set *self, char *element) {
+	return set_remove_slot(self, set_probe_string(element));
+}
+
+bool set_add_int(t_set *self, uint64_t element) {
+	return set_add_slot(self, set_probe_number(element));
+}
+
+bool set_contains_int(t_set *self, uint64_t element) {
+	t_set_slot probe = set_probe_number(element);
+	return set_find_index(self, &probe) != -1;
+}
+
+bool set_remove_int(t_set *self, uint64_t element) {
+	return set_remove_slot(self, set_probe_number(element));
+}
+
+void set_iterate(t_set *self, void(*closure)(char*)) {
+	for (int index = 0; index < self->table_max_size; index++) {
+		if (self->used[index]) {
+			closure(self->elements[index].string);
+		}
+	}
+}
+
+void set_iterate_int(t_set *self, void(*closure)(uint64_t)) {
+	for (int index = 0; index < self->table_max_size; index++) {
+		if (self->used[index]) {
+			closure(self->elements[index].number);
+		}
+	}
+}
+
+t_set *set_union(t_set *self, t_set *other) {
+	t_set *larger = self->elements_amount >= other->elements_amount ? self : other;
+	t_set *smaller = larger == self ? other : self;
+	t_set *result = set_create_internal(self->strings, self->elements_amount + other->elements_amount);
+
+	set_copy_all(result, larger);
+	for (int index = 0; index < smaller->table_max_size; index++) {
+		if (smaller->used[index] && set_find_index(larger, &smaller->elements[index]) == -1) {
+			set_insert_copy(result, &smaller->elements[index]);
+		}
+	}
+	return result;
+}
+
+t_set *set_intersection(t_set *self, t_set *other) {
+	t_set *larger = self->elements_amount >= other->elements_amount ? self : other;
+	t_set *smaller = larger == self ? other : self;
+	t_set *result = set_create_internal(self->strings, smaller->elements_amount);
+
+	for (int index = 0; index < smaller->table_max_size; index++) {
+		if (smaller->used[index] && set_find_index(larger, &smaller->elements[index]) != -1) {
+			set_insert_copy(result, &smaller->elements[index]);
+		}
+	}
+	return result;
+}
+
+t_set *set_difference(t_set *self, t_set *other) {
+	t_set *result = set_create_internal(self->strings, self->elements_amount);
+
+	if (self->elements_amount <= other->elements_amount) {
+		for (int index = 0; index < self->table_max_size; index++) {
+			if (self->used[index] && set_find_index(other, &self->elements[index]) == -1) {
+				set_insert_copy(result, &self->elements[index]);
+			}
+		}
+		return result;
+	}
+
+	// Si el sustraendo es más chico conviene copiar todo y quitar sus elementos
+	set_copy_all(result, self);
+	for (int index = 0; index < other->table_max_size; index++) {
+		if (other->used[index]) {
+			set_remove_slot(result, other->elements[index]);
+		}
+	}
+	return result;
+}
+
+void set_clean(t_set *self) {
+	if (self->strings) {
+		set_iterate(self, (void*) free);
+	}
+
+	memset(self->used, false, self->table_max_size * sizeof(bool));
+	self->elements_amount = 0;
+}
+
+int set_size(t_set *self) {
+	return self->elements_amount;
+}
+
+bool set_is_empty(t_set *self) {
+	return self->elements_amount == 0;
+}
+
+void set_destroy(t_set *self) {
+	set_clean(self);
+	free(self->elements);
+	free(self->used);
+	free(self);
+}
+
+/********* PRIVATE FUNCTIONS **************/
+
+static t_set *set_create_internal(bool strings, int capacity) {
+	t_set *self = malloc(sizeof(t_set));
+	self->strings = strings;
+	set_table_create(self, capacity);
+	return self;
+}
+
+static uint64_t set_hash_number(uint64_t number) {
+	// Finalizador de MurmurHash3, igual que en t_int_dictionary
+	number ^= number >> 33;
+	number *= 0xff51afd7ed558ccdull;
+	number ^= number >> 33;
+	number *= 0xc4ceb9fe1a85ec53ull;
+	number ^= number >> 33;
+	return number;
+}
+
+static uint64_t set_hash_string(char *string) {
+	// FNV-1a, mezclado al final para que los bits bajos usados como
+	// posición dependan de todos los caracteres
+	uint64_t hash = 0xcbf29ce484222325ull;
+	for (unsigned char *byte = (unsigned char*) string; *byte != '\0'; byte++) {
+		hash = (hash ^ *byte) * 0x100000001b3ull;
+	}
+	return set_hash_number(hash);
+}
+
+static t_set_slot set_probe_string(char *string) {
+	return (t_set_slot) { .hash = set_hash_string(string), .string = string };
+}
+
+static t_set_slot set_probe_number(uint64_t number) {
+	return (t_set_slot) { .hash = set_hash_number(number), .number = number };
+}
+
+static bool set_add_slot(t_set *self, t_set_slot probe) {
+	if (set_find_index(self, &probe) != -1) {
+		return false;
+	}
+
+	// Con sondeo lineal se mantiene la tabla a lo sumo 3/4 llena
+	if ((self->elements_amount + 1) * 4 > self->table_max_size * 3) {
+		set_resize(self, self->table_max_size * 2 * 3 / 4);
+	}
+	set_insert_copy(self, &probe);
+	return true;
+}
+
+static bool set_remove_slot(t_set *self, t_set_slot probe) {
+	int index = set_find_index(self, &probe);
+	if (index == -1) {
+		return false;
+	}
+
+	if (self->strings) {
+		free(self->elements[index].string);
+	}
+	set_remove_index(self, index);
+	return true;
+}
+
+static int set_find_index(t_set *self, t_set_slot *probe) {
+	// Se compara primero el hash guardado, así sólo se comparan los
+	// strings que casi seguro son iguales
+	int mask = self->table_max_size - 1;
+	int index = probe->hash & mask;
+	while (self->used[index]) {
+		t_set_slot *slot = &self->elements[index];
+		if (slot->hash == probe->hash
+				&& (self->strings ? strcmp(slot->string, probe->string) == 0 : slot->number == probe->number)) {
+			return index;
+		}
+		index = (index + 1) & mask;
+	}
+	return -1;
+}
+
+static void set_insert_unique(t_set *self, t_set_slot *slot) {
+	// Asume que el elemento no está y que hay lugar, por lo que no compara
+	// contra los elementos existentes
+	int mask = self->table_max_size - 1;
+	int index = slot->hash & mask;
+	while (self->used[index]) {
+		index = (index + 1) & mask;
+	}
+
+	self->used[index] = true;
+	self->elements[index] = *slot;
+	self->elements_amount++;
+}
+
+static void set_insert_copy(t_set *self, t_set_slot *slot) {
+	t_set_slot copy = *slot;
+	if (self->strings) {
+		copy.string = strdup(slot->string);
+	}
+	set_insert_unique(self, &copy);
+}
+
+static void set_copy_all(t_set *self, t_set *source) {
+	for (int index = 0; index < source->table_max_size; index++) {
+		if (source->used[index]) {
+			set_insert_copy(self, &source->elements[index]);
+		}
+	}
+}
+
+static void set_table_create(t_set *self, int capacity) {
+	int table_max_size = 16;
+	while (table_max_size * 3 < capacity * 4) {
+		table_max_size *= 2;
+	}
+
+	self->table_max_size = table_max_size;
+	self->elements_amount = 0;
+	self->elements = malloc(table_max_size * sizeof(t_set_slot));
+	self->used = calloc(table_max_size, sizeof(bool));
+}
+
+static void set_resize(t_set *self, int capacity) {
+	t_set_slot *old_elements = self->elements;
+	bool *old_used = self->used;
+	int old_max_size = self->table_max_size;
+
+	// Los slots conservan su hash, por lo que no hace falta recalcularlo
+	set_table_create(self, capacity);
+	for (int index = 0; index < old_max_size; index++) {
+		if (old_used[index]) {
+			set_insert_unique(self, &old_elements[index]);
+		}
+	}
+
+	free(old_elements);
+	free(old_used);
+}
+
+static void set_remove_index(t_set *self, int index) {
+	// Igual que en t_int_dictionary, se corren hacia atrás los elementos
+	// siguientes en lugar de dejar una marca de borrado
+	int mask = self->table_max_size - 1;
+	int next = index;
+	while (true) {
+		next = (next + 1) & mask;
+		if (!self->used[next]) {
+			break;
+		}
+		int home = self->elements[next].hash & mask;
+		if (!set_is_between(home, index, next)) {
+			self->elements[index] = self->elements[next];
+			index = next;
+		}
+	}
+
+	self->used[index] = false;
+	self->elements_amount--;
+}
+
+static bool set_is_between(int index, int from, int to) {
+	// Retorna true si index está en el intervalo circular (from, to]
+	return from <= to ? from < index && index <= to : from < index || index <= to;
+}
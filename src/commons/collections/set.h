@@ -0,0 +1,186 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SET_H_
+#define SET_H_
+
+	#define DEFAULT_SET_INITIAL_SIZE 20
+
+	#include <stdbool.h>
+	#include <stdint.h>
+
+	/**
+	 * @file
+	 * @brief `#include <commons/collections/set.h>`
+	 *
+	 * Conjunto de elementos sin repetidos implementado sobre una tabla de
+	 * hash. Un conjunto guarda strings (creado con `set_create()`) o enteros
+	 * (creado con `set_create_int()`); los punteros se guardan como enteros
+	 * convirtiéndolos con `(uintptr_t)`.
+	 *
+	 * Saber si un elemento pertenece al conjunto no depende de la cantidad de
+	 * elementos, a diferencia de buscarlo en una `t_list` con
+	 * `list_any_satisfy()`.
+	 */
+
+	/** @cond INCLUDE_INTERNALS */
+	typedef struct {
+		uint64_t hash;
+		union {
+			char *string;
+			uint64_t number;
+		};
+	} t_set_slot;
+	/** @endcond */
+
+	/**
+	 * @struct t_set
+	 * @brief Conjunto de strings o de enteros. Inicializar con `set_create()`
+	 *        o `set_create_int()`.
+	 */
+	typedef struct {
+		t_set_slot *elements;
+		bool *used;
+		int table_max_size;
+		int elements_amount;
+		bool strings;
+	} t_set;
+
+	/**
+	 * @brief Crea un conjunto de strings
+	 * @return Retorna un puntero al conjunto creado, liberable con
+	 *         `set_destroy()`.
+	 *
+	 * El conjunto guarda una copia de cada string agregado, por lo que el
+	 * original puede liberarse luego de agregarlo.
+	 */
+	t_set *set_create(void);
+
+	/**
+	 * @brief Crea un conjunto de enteros o punteros
+	 * @return Retorna un puntero al conjunto creado, liberable con
+	 *         `set_destroy()`.
+	 *
+	 * Ejemplo de uso:
+	 * @code
+	 * t_set* visited = set_create_int();
+	 * set_add_int(visited, (uintptr_t) node);
+	 * ...
+	 * if (!set_contains_int(visited, (uintptr_t) neighbour)) {
+	 *     ...
+	 * }
+	 * @endcode
+	 */
+	t_set *set_create_int(void);
+
+	/**
+	 * @brief Reserva lugar para al menos `capacity` elementos, evitando
+	 *        redimensionar la tabla mientras se agregan.
+	 */
+	void set_reserve(t_set *, int capacity);
+
+	/**
+	 * @brief Agrega un string a un conjunto de strings
+	 * @return true si el string no pertenecía al conjunto.
+	 */
+	bool set_add(t_set *, char *element);
+
+	/**
+	 * @brief Retorna true si el string pertenece al conjunto
+	 */
+	bool set_contains(t_set *, char *element);
+
+	/**
+	 * @brief Quita un string del conjunto, liberando su copia
+	 * @return true si el string pertenecía al conjunto.
+	 */
+	bool set_remove(t_set *, char *element);
+
+	/**
+	 * @brief Agrega un entero a un conjunto de enteros
+	 * @return true si el entero no pertenecía al conjunto.
+	 */
+	bool set_add_int(t_set *, uint64_t element);
+
+	/**
+	 * @brief Retorna true si el entero pertenece al conjunto
+	 */
+	bool set_contains_int(t_set *, uint64_t element);
+
+	/**
+	 * @brief Quita un entero del conjunto
+	 * @return true si el entero pertenecía al conjunto.
+	 */
+	bool set_remove_int(t_set *, uint64_t element);
+
+	/**
+	 * @brief Aplica closure a todos los strings del conjunto, sin un orden
+	 *        en particular.
+	 */
+	void set_iterate(t_set *, void(*closure)(char*));
+
+	/**
+	 * @brief Aplica closure a todos los enteros del conjunto, sin un orden
+	 *        en particular.
+	 */
+	void set_iterate_int(t_set *, void(*closure)(uint64_t));
+
+	/**
+	 * @brief Crea un nuevo conjunto con los elementos de ambos conjuntos
+	 * @return Un conjunto del mismo tipo que los operandos, liberable con
+	 *         `set_destroy()`.
+	 *
+	 * @note Ambos conjuntos deben ser del mismo tipo. Las operaciones entre
+	 *       conjuntos reservan el resultado de una sola vez y sólo buscan en
+	 *       el otro conjunto los elementos del operando más chico.
+	 */
+	t_set *set_union(t_set *, t_set *);
+
+	/**
+	 * @brief Crea un nuevo conjunto con los elementos que pertenecen a ambos
+	 *        conjuntos
+	 * @see set_union
+	 */
+	t_set *set_intersection(t_set *, t_set *);
+
+	/**
+	 * @brief Crea un nuevo conjunto con los elementos de `self` que no
+	 *        pertenecen a `other`
+	 * @see set_union
+	 */
+	t_set *set_difference(t_set *self, t_set *other);
+
+	/**
+	 * @brief Quita todos los elementos del conjunto
+	 */
+	void set_clean(t_set *);
+
+	/**
+	 * @brief Retorna la cantidad de elementos del conjunto
+	 */
+	int set_size(t_set *);
+
+	/**
+	 * @brief Retorna true si el conjunto está vacío
+	 */
+	bool set_is_empty(t_set *);
+
+	/**
+	 * @brief Destruye el conjunto, liberando las copias de sus strings
+	 */
+	void set_destroy(t_set *);
+
+#endif /* SET_H_ */
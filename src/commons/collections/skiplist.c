@@ -0,0 +1,420 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <sched.h>
+#include <stdlib.h>
+#include "skiplist.h"
+
+/*
+ * Skip list "perezosa" de Herlihy, Lev, Luchangco y Shavit. Un nodo está en
+ * la lista una vez que fully_linked es true y hasta que marked es true:
+ *   - Para agregar se bloquean los predecesores de cada nivel, se verifica
+ *     que sigan apuntando a los sucesores encontrados y se enlaza el nodo
+ *     de abajo hacia arriba.
+ *   - Para quitar se marca el nodo con su lock tomado y luego se lo
+ *     desenlaza de arriba hacia abajo con los predecesores bloqueados.
+ * Las búsquedas recorren los punteros sin locks y sólo consultan las marcas.
+ */
+
+static __thread uint64_t random_state;
+static __thread int epoch_slot = -1;
+static atomic_int next_epoch_slot;
+
+static t_skiplist_node *skiplist_create_node(uint64_t key, void *element, int top_level);
+static void skiplist_destroy_node(t_skiplist_node *node);
+static int skiplist_random_level(void);
+static int skiplist_find_node(t_skiplist *self, uint64_t key, t_skiplist_node **predecessors, t_skiplist_node **successors);
+static void skiplist_unlock_predecessors(t_skiplist_node **predecessors, int highest_locked);
+static t_skiplist_epoch_slot *skiplist_enter(t_skiplist *self);
+static void skiplist_exit(t_skiplist_epoch_slot *slot);
+static bool skiplist_retire(t_skiplist *self, t_skiplist_node *node);
+static bool skiplist_try_advance_epoch(t_skiplist *self, uint64_t epoch);
+static void skiplist_destroy_nodes(t_skiplist_node *node);
+
+t_skiplist *skiplist_create() {
+	// Cada slot ocupa su propia línea de caché, así los lectores de distintos
+	// hilos no escriben sobre una misma línea
+	t_skiplist *self = aligned_alloc(_Alignof(t_skiplist), sizeof(t_skiplist));
+	self->head = skiplist_create_node(0, NULL, SKIPLIST_MAX_LEVEL - 1);
+	atomic_store(&self->head->fully_linked, true);
+	atomic_init(&self->elements_count, 0);
+	atomic_init(&self->epoch, 0);
+	for (int i = 0; i < SKIPLIST_EPOCH_SLOTS; i++) {
+		atomic_init(&self->slots[i].state, 0);
+	}
+	pthread_mutex_init(&self->retired_lock, NULL);
+	for (int i = 0; i < SKIPLIST_RETIRED_LISTS; i++) {
+		self->retired[i] = NULL;
+	}
+	self->retired_count = 0;
+	return self;
+}
+
+bool skiplist_insert(t_skiplist *self, uint64_t key, void *element) {
+	t_skiplist_node *predecessors[SKIPLIST_MAX_LEVEL];
+	t_skiplist_node *successors[SKIPLIST_MAX_LEVEL];
+	int top_level = skiplist_random_level();
+	t_skiplist_epoch_slot *slot = skiplist_enter(self);
+
+	while (true) {
+		int found_level = skiplist_find_node(self, key, predecessors, successors);
+		if (found_level != -1) {
+			t_skiplist_node *found = successors[found_level];
+			if (!atomic_load(&found->marked)) {
+				// Otro hilo lo está agregando: se espera a que termine para
+				// que quien reciba false pueda encontrarlo
+				while (!atomic_load(&found->fully_linked)) {
+					sched_yield();
+				}
+				skiplist_exit(slot);
+				return false;
+			}
+			continue;
+		}
+
+		int highest_locked = -1;
+		bool valid = true;
+		for (int level = 0; valid && level <= top_level; level++) {
+			t_skiplist_node *predecessor = predecessors[level];
+			t_skiplist_node *successor = successors[level];
+			if (level == 0 || predecessor != predecessors[level - 1]) {
+				pthread_mutex_lock(&predecessor->lock);
+			}
+			highest_locked = level;
+			valid = !atomic_load(&predecessor->marked)
+					&& (successor == NULL || !atomic_load(&successor->marked))
+					&& atomic_load(&predecessor->next[level]) == successor;
+		}
+		if (!valid) {
+			skiplist_unlock_predecessors(predecessors, highest_locked);
+			continue;
+		}
+
+		t_skiplist_node *node = skiplist_create_node(key, element, top_level);
+		for (int level = 0; level <= top_level; level++) {
+			atomic_store(&node->next[level], successors[level]);
+		}
+		for (int level = 0; level <= top_level; level++) {
+			atomic_store(&predecessors[level]->next[level], node);
+		}
+		atomic_store(&node->fully_linked, true);
+		skiplist_unlock_predecessors(predecessors, highest_locked);
+
+		atomic_fetch_add(&self->elements_count, 1);
+		skiplist_exit(slot);
+		return true;
+	}
+}
+
+void *skiplist_remove(t_skiplist *self, uint64_t key) {
+	t_skiplist_node *predecessors[SKIPLIST_MAX_LEVEL];
+	t_skiplist_node *successors[SKIPLIST_MAX_LEVEL];
+	t_skiplist_node *victim = NULL;
+	t_skiplist_epoch_slot *slot = skiplist_enter(self);
+
+	while (true) {
+		int found_level = skiplist_find_node(self, key, predecessors, successors);
+		if (victim == NULL) {
+			// Sólo se quita un nodo ya enlazado en todos sus niveles, y que
+			// se encontró en su nivel más alto
+			t_skiplist_node *found = found_level != -1 ? successors[found_level] : NULL;
+			if (found == NULL || !atomic_load(&found->fully_linked)
+					|| found->top_level != found_level || atomic_load(&found->marked)) {
+				skiplist_exit(slot);
+				return NULL;
+			}
+
+			pthread_mutex_lock(&found->lock);
+			if (atomic_load(&found->marked)) {
+				pthread_mutex_unlock(&found->lock);
+				skiplist_exit(slot);
+				return NULL;
+			}
+			atomic_store(&found->marked, true);
+			victim = found;
+		}
+
+		int highest_locked = -1;
+		bool valid = true;
+		for (int level = 0; valid && level <= victim->top_level; level++) {
+			t_skiplist_node *predecessor = predecessors[level];
+			if (level == 0 || predecessor != predecessors[level - 1]) {
+				pthread_mutex_lock(&predecessor->lock);
+			}
+			highest_locked = level;
+			valid = !atomic_load(&predecessor->marked)
+					&& atomic_load(&predecessor->next[level]) == victim;
+		}
+		if (!valid) {
+			skiplist_unlock_predecessors(predecessors, highest_locked);
+			continue;
+		}
+
+		for (int level = victim->top_level; level >= 0; level--) {
+			atomic_store(&predecessors[level]->next[level], atomic_load(&victim->next[level]));
+		}
+		pthread_mutex_unlock(&victim->lock);
+		skiplist_unlock_predecessors(predecessors, highest_locked);
+
+		void *element = victim->element;
+		atomic_fetch_sub(&self->elements_count, 1);
+		bool backlogged = skiplist_retire(self, victim);
+		skiplist_exit(slot);
+		if (backlogged) {
+			// Se cede el procesador para que los lectores demorados terminen
+			// y la época pueda avanzar
+			sched_yield();
+		}
+		return element;
+	}
+}
+
+void *skiplist_find(t_skiplist *self, uint64_t key) {
+	t_skiplist_node *predecessors[SKIPLIST_MAX_LEVEL];
+	t_skiplist_node *successors[SKIPLIST_MAX_LEVEL];
+	t_skiplist_epoch_slot *slot = skiplist_enter(self);
+
+	void *element = NULL;
+	int found_level = skiplist_find_node(self, key, predecessors, successors);
+	if (found_level != -1) {
+		t_skiplist_node *found = successors[found_level];
+		if (atomic_load(&found->fully_linked) && !atomic_load(&found->marked)) {
+			element = found->element;
+		}
+	}
+
+	skiplist_exit(slot);
+	return element;
+}
+
+bool skiplist_contains(t_skiplist *self, uint64_t key) {
+	t_skiplist_node *predecessors[SKIPLIST_MAX_LEVEL];
+	t_skiplist_node *successors[SKIPLIST_MAX_LEVEL];
+	t_skiplist_epoch_slot *slot = skiplist_enter(self);
+
+	int found_level = skiplist_find_node(self, key, predecessors, successors);
+	bool contains = found_level != -1
+			&& atomic_load(&successors[found_level]->fully_linked)
+			&& !atomic_load(&successors[found_level]->marked);
+
+	skiplist_exit(slot);
+	return contains;
+}
+
+void *skiplist_ceil(t_skiplist *self, uint64_t key, uint64_t *ceil_key) {
+	t_skiplist_node *predecessors[SKIPLIST_MAX_LEVEL];
+	t_skiplist_node *successors[SKIPLIST_MAX_LEVEL];
+	t_skiplist_epoch_slot *slot = skiplist_enter(self);
+
+	skiplist_find_node(self, key, predecessors, successors);
+	t_skiplist_node *node = successors[0];
+	while (node != NULL && (atomic_load(&node->marked) || !atomic_load(&node->fully_linked))) {
+		node = atomic_load(&node->next[0]);
+	}
+
+	void *element = NULL;
+	if (node != NULL) {
+		element = node->element;
+		if (ceil_key != NULL) {
+			*ceil_key = node->key;
+		}
+	}
+
+	skiplist_exit(slot);
+	return element;
+}
+
+void skiplist_iterate(t_skiplist *self, void(*closure)(uint64_t key, void* element)) {
+	t_skiplist_epoch_slot *slot = skiplist_enter(self);
+	for (t_skiplist_node *node = atomic_load(&self->head->next[0]); node != NULL; node = atomic_load(&node->next[0])) {
+		if (atomic_load(&node->fully_linked) && !atomic_load(&node->marked)) {
+			closure(node->key, node->element);
+		}
+	}
+	skiplist_exit(slot);
+}
+
+int skiplist_size(t_skiplist *self) {
+	return atomic_load(&self->elements_count);
+}
+
+bool skiplist_is_empty(t_skiplist *self) {
+	return skiplist_size(self) == 0;
+}
+
+void skiplist_destroy(t_skiplist *self) {
+	skiplist_destroy_and_destroy_elements(self, NULL);
+}
+
+void skiplist_destroy_and_destroy_elements(t_skiplist *self, void(*element_destroyer)(void*)) {
+	t_skiplist_node *node = self->head;
+	while (node != NULL) {
+		t_skiplist_node *next = atomic_load(&node->next[0]);
+		if (element_destroyer != NULL && node != self->head) {
+			element_destroyer(node->element);
+		}
+		skiplist_destroy_node(node);
+		node = next;
+	}
+
+	for (int i = 0; i < SKIPLIST_RETIRED_LISTS; i++) {
+		skiplist_destroy_nodes(self->retired[i]);
+	}
+
+	pthread_mutex_destroy(&self->retired_lock);
+	free(self);
+}
+
+/********* PRIVATE FUNCTIONS **************/
+
+static t_skiplist_node *skiplist_create_node(uint64_t key, void *element, int top_level) {
+	t_skiplist_node *node = malloc(sizeof(t_skiplist_node) + (top_level + 1) * sizeof(_Atomic(t_skiplist_node*)));
+	node->key = key;
+	node->element = element;
+	node->top_level = top_level;
+	atomic_init(&node->marked, false);
+	atomic_init(&node->fully_linked, false);
+	pthread_mutex_init(&node->lock, NULL);
+	node->retired_next = NULL;
+	for (int level = 0; level <= top_level; level++) {
+		atomic_init(&node->next[level], NULL);
+	}
+	return node;
+}
+
+static void skiplist_destroy_node(t_skiplist_node *node) {
+	pthread_mutex_destroy(&node->lock);
+	free(node);
+}
+
+static int skiplist_random_level() {
+	// Cada nivel tiene la mitad de los nodos del anterior
+	if (random_state == 0) {
+		random_state = (uintptr_t) &random_state | 1;
+	}
+	random_state ^= random_state << 13;
+	random_state ^= random_state >> 7;
+	random_state ^= random_state << 17;
+
+	int level = 0;
+	uint64_t bits = random_state;
+	while ((bits & 1) && level < SKIPLIST_MAX_LEVEL - 1) {
+		level++;
+		bits >>= 1;
+	}
+	return level;
+}
+
+static int skiplist_find_node(t_skiplist *self, uint64_t key, t_skiplist_node **predecessors, t_skiplist_node **successors) {
+	// Deja en cada nivel el último nodo con una key menor y el siguiente, y
+	// retorna el nivel más alto en el que se encontró la key, o -1
+	int found_level = -1;
+	t_skiplist_node *predecessor = self->head;
+	for (int level = SKIPLIST_MAX_LEVEL - 1; level >= 0; level--) {
+		t_skiplist_node *current = atomic_load(&predecessor->next[level]);
+		while (current != NULL && current->key < key) {
+			predecessor = current;
+			current = atomic_load(&predecessor->next[level]);
+		}
+		if (found_level == -1 && current != NULL && current->key == key) {
+			found_level = level;
+		}
+		predecessors[level] = predecessor;
+		successors[level] = current;
+	}
+	return found_level;
+}
+
+static void skiplist_unlock_predecessors(t_skiplist_node **predecessors, int highest_locked) {
+	for (int level = 0; level <= highest_locked; level++) {
+		if (level == 0 || predecessors[level] != predecessors[level - 1]) {
+			pthread_mutex_unlock(&predecessors[level]->lock);
+		}
+	}
+}
+
+static t_skiplist_epoch_slot *skiplist_enter(t_skiplist *self) {
+	// Cada hilo reusa el último slot que ocupó; si está tomado (por ejemplo
+	// por una operación anidada) se prueba con los siguientes
+	if (epoch_slot == -1) {
+		epoch_slot = atomic_fetch_add(&next_epoch_slot, 1) % SKIPLIST_EPOCH_SLOTS;
+	}
+
+	for (int attempt = 0; true; attempt++) {
+		int index = (epoch_slot + attempt) % SKIPLIST_EPOCH_SLOTS;
+		uint64_t free_state = 0;
+		uint64_t state = atomic_load(&self->epoch) << 1 | 1;
+		if (atomic_compare_exchange_strong(&self->slots[index].state, &free_state, state)) {
+			epoch_slot = index;
+			return &self->slots[index];
+		}
+		if (attempt % SKIPLIST_EPOCH_SLOTS == SKIPLIST_EPOCH_SLOTS - 1) {
+			sched_yield();
+		}
+	}
+}
+
+static void skiplist_exit(t_skiplist_epoch_slot *slot) {
+	atomic_store(&slot->state, 0);
+}
+
+static bool skiplist_retire(t_skiplist *self, t_skiplist_node *node) {
+	// Un nodo retirado en la época e ya no es alcanzable para las operaciones
+	// que empiecen después. Para llegar a la época e + 2 todas las operaciones
+	// en curso tienen que haber anunciado e + 1, por lo que las que podían
+	// verlo ya terminaron.
+	pthread_mutex_lock(&self->retired_lock);
+	uint64_t epoch = atomic_load(&self->epoch);
+	node->retired_next = self->retired[epoch % SKIPLIST_RETIRED_LISTS];
+	self->retired[epoch % SKIPLIST_RETIRED_LISTS] = node;
+	self->retired_count++;
+
+	t_skiplist_node *reclaimable = NULL;
+	if (skiplist_try_advance_epoch(self, epoch)) {
+		// La lista de la época anterior pasa a tener dos épocas de antigüedad
+		int previous = (epoch + SKIPLIST_RETIRED_LISTS - 1) % SKIPLIST_RETIRED_LISTS;
+		reclaimable = self->retired[previous];
+		self->retired[previous] = NULL;
+		for (t_skiplist_node *retired = reclaimable; retired != NULL; retired = retired->retired_next) {
+			self->retired_count--;
+		}
+	}
+	bool backlogged = self->retired_count > SKIPLIST_RETIRED_THRESHOLD;
+	pthread_mutex_unlock(&self->retired_lock);
+
+	skiplist_destroy_nodes(reclaimable);
+	return backlogged;
+}
+
+static bool skiplist_try_advance_epoch(t_skiplist *self, uint64_t epoch) {
+	// Sólo se avanza si toda operación en curso ya anunció la época actual
+	for (int i = 0; i < SKIPLIST_EPOCH_SLOTS; i++) {
+		uint64_t state = atomic_load(&self->slots[i].state);
+		if (state != 0 && state >> 1 != epoch) {
+			return false;
+		}
+	}
+	atomic_store(&self->epoch, epoch + 1);
+	return true;
+}
+
+static void skiplist_destroy_nodes(t_skiplist_node *node) {
+	while (node != NULL) {
+		t_skiplist_node *next = node->retired_next;
+		skiplist_destroy_node(node);
+		node = next;
+	}
+}
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SKIPLIST_H_
+#define SKIPLIST_H_
+
+	#define SKIPLIST_MAX_LEVEL 24
+	#define SKIPLIST_EPOCH_SLOTS 64
+	#define SKIPLIST_RETIRED_LISTS 3
+	#define SKIPLIST_RETIRED_THRESHOLD 256
+
+	#include <pthread.h>
+	#include <stdatomic.h>
+	#include <stdbool.h>
+	#include <stdint.h>
+
+	/**
+	 * @file
+	 * @brief `#include <commons/collections/skiplist.h>`
+	 *
+	 * Conjunto ordenado de pares entero->puntero que puede ser usado por
+	 * varios hilos a la vez sin un mutex global. Las búsquedas y recorridos no
+	 * toman ningún lock, y agregar o quitar sólo bloquea a los nodos vecinos
+	 * del que se modifica, por lo que los lectores nunca esperan a los
+	 * escritores y escritores en distintas zonas no se esperan entre sí.
+	 *
+	 * Los nodos quitados no se liberan en el momento, ya que algún lector
+	 * podría seguir recorriéndolos: cada operación anuncia la época global en
+	 * que empezó, y los nodos quitados en una época se liberan dos épocas más
+	 * tarde, cuando ya no queda ninguna operación anterior en curso. Si se
+	 * acumulan más de SKIPLIST_RETIRED_THRESHOLD nodos sin liberar, quien
+	 * quita cede el procesador para que los lectores demorados avancen.
+	 */
+
+	/** @cond INCLUDE_INTERNALS */
+	typedef struct t_skiplist_node {
+		uint64_t key;
+		void *element;
+		int top_level;
+		atomic_bool marked;
+		atomic_bool fully_linked;
+		pthread_mutex_t lock;
+		struct t_skiplist_node *retired_next;
+		_Atomic(struct t_skiplist_node*) next[];
+	} t_skiplist_node;
+
+	typedef struct {
+		// 0 si está libre, o la época anunciada por la operación en curso
+		// corrida un bit y con el bit menos significativo en 1
+		_Alignas(64) _Atomic uint64_t state;
+	} t_skiplist_epoch_slot;
+	/** @endcond */
+
+	/**
+	 * @struct t_skiplist
+	 * @brief Skip list concurrente. Inicializar con `skiplist_create()`
+	 */
+	typedef struct {
+		t_skiplist_node *head;
+		atomic_int elements_count;
+		_Atomic uint64_t epoch;
+		t_skiplist_epoch_slot slots[SKIPLIST_EPOCH_SLOTS];
+		pthread_mutex_t retired_lock;
+		t_skiplist_node *retired[SKIPLIST_RETIRED_LISTS];
+		int retired_count;
+	} t_skiplist;
+
+	/**
+	 * @brief Crea una skip list
+	 * @return Retorna un puntero a la lista creada, liberable con
+	 *         `skiplist_destroy()` o `skiplist_destroy_and_destroy_elements()`
+	 *         una vez que ningún hilo la usa.
+	 *
+	 * Ejemplo de uso:
+	 * @code
+	 * t_skiplist* holes = skiplist_create();
+	 * skiplist_insert(holes, (uint64_t) hole->size << 32 | hole->base, hole);
+	 * ...
+	 * // Desde cualquier hilo, sin tomar un mutex
+	 * t_hole* best_fit = skiplist_ceil(holes, (uint64_t) size << 32, NULL);
+	 * @endcode
+	 */
+	t_skiplist *skiplist_create(void);
+
+	/**
+	 * @brief Agrega el par (key->element) si la key no existe
+	 * @return false si la key ya estaba en la lista, en cuyo caso no se
+	 *         modifica el elemento existente.
+	 */
+	bool skiplist_insert(t_skiplist *, uint64_t key, void *element);
+
+	/**
+	 * @brief Quita el par de la key y retorna su elemento, o NULL si la key
+	 *        no existe.
+	 */
+	void *skiplist_remove(t_skiplist *, uint64_t key);
+
+	/**
+	 * @brief Retorna el elemento asociado a la key, o NULL si no existe.
+	 */
+	void *skiplist_find(t_skiplist *, uint64_t key);
+
+	/**
+	 * @brief Retorna true si key se encuentra en la lista
+	 */
+	bool skiplist_contains(t_skiplist *, uint64_t key);
+
+	/**
+	 * @brief Obtiene el elemento de menor key mayor o igual a `key`.
+	 * @param[out] ceil_key Si no es NULL, se guarda la key encontrada.
+	 * @return El elemento encontrado, o NULL si todas las keys son menores.
+	 */
+	void *skiplist_ceil(t_skiplist *, uint64_t key, uint64_t *ceil_key);
+
+	/**
+	 * @brief Aplica closure a todos los pares de la lista, en orden creciente
+	 *        de key.
+	 * @note Si otros hilos modifican la lista durante el recorrido, los pares
+	 *       agregados o quitados en ese momento pueden o no ser visitados.
+	 */
+	void skiplist_iterate(t_skiplist *, void(*closure)(uint64_t key, void* element));
+
+	/**
+	 * @brief Retorna la cantidad de elementos de la lista
+	 */
+	int skiplist_size(t_skiplist *);
+
+	/**
+	 * @brief Retorna true si la lista está vacía
+	 */
+	bool skiplist_is_empty(t_skiplist *);
+
+	/**
+	 * @brief Destruye la lista sin liberar los elementos que contiene
+	 */
+	void skiplist_destroy(t_skiplist *);
+
+	/**
+	 * @brief Destruye la lista, liberando los elementos que contiene con
+	 *        `element_destroyer`
+	 */
+	void skiplist_destroy_and_destroy_elements(t_skiplist *, void(*element_destroyer)(void*));
+
+#endif /* SKIPLIST_H_ */
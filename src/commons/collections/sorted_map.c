@@ -0,0 +1,457 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "sorted_map.h"
+
+/*
+ * Árbol B+: los pares están sólo en las hojas, y cada nodo interno con
+ * count claves tiene count + 1 hijos. Las claves menores a keys[i] están en
+ * children[i] y las mayores o iguales en children[i + 1]. Todo nodo salvo
+ * la raíz tiene al menos SORTED_MAP_MIN_COUNT claves.
+ */
+#define SORTED_MAP_MIN_COUNT (SORTED_MAP_NODE_CAPACITY / 2)
+
+static t_sorted_map_node *sorted_map_create_node(bool leaf);
+static void sorted_map_destroy_node(t_sorted_map_node *node, void(*element_destroyer)(void*));
+static int sorted_map_lower_bound(t_sorted_map_node *node, uint64_t key);
+static int sorted_map_upper_bound(t_sorted_map_node *node, uint64_t key);
+static t_sorted_map_node *sorted_map_find_leaf(t_sorted_map *self, uint64_t key);
+static t_sorted_map_node *sorted_map_insert(t_sorted_map *self, t_sorted_map_node *node, uint64_t key, void *element, uint64_t *separator);
+static t_sorted_map_node *sorted_map_split_leaf(t_sorted_map_node *leaf, uint64_t *separator);
+static t_sorted_map_node *sorted_map_split_internal(t_sorted_map_node *node, uint64_t *separator);
+static void *sorted_map_remove_key(t_sorted_map *self, uint64_t key, bool *removed);
+static void *sorted_map_delete(t_sorted_map *self, t_sorted_map_node *node, uint64_t key, bool *removed);
+static void sorted_map_rebalance(t_sorted_map_node *parent, int index);
+static void sorted_map_merge(t_sorted_map_node *parent, int index);
+static void sorted_map_iterate_from(t_sorted_map_node *leaf, int index, uint64_t to, void(*closure)(uint64_t, void*));
+
+t_sorted_map *sorted_map_create() {
+	t_sorted_map *self = malloc(sizeof(t_sorted_map));
+	self->root = sorted_map_create_node(true);
+	self->elements_count = 0;
+	return self;
+}
+
+void sorted_map_put(t_sorted_map *self, uint64_t key, void *element) {
+	uint64_t separator;
+	t_sorted_map_node *right = sorted_map_insert(self, self->root, key, element, &separator);
+	if (right != NULL) {
+		t_sorted_map_node *root = sorted_map_create_node(false);
+		root->keys[0] = separator;
+		root->children[0] = self->root;
+		root->children[1] = right;
+		root->count = 1;
+		self->root = root;
+	}
+}
+
+void *sorted_map_get(t_sorted_map *self, uint64_t key) {
+	t_sorted_map_node *leaf = sorted_map_find_leaf(self, key);
+	int index = sorted_map_lower_bound(leaf, key);
+	return index < leaf->count && leaf->keys[index] == key ? leaf->values[index] : NULL;
+}
+
+bool sorted_map_has_key(t_sorted_map *self, uint64_t key) {
+	t_sorted_map_node *leaf = sorted_map_find_leaf(self, key);
+	int index = sorted_map_lower_bound(leaf, key);
+	return index < leaf->count && leaf->keys[index] == key;
+}
+
+void *sorted_map_remove(t_sorted_map *self, uint64_t key) {
+	bool removed;
+	return sorted_map_remove_key(self, key, &removed);
+}
+
+void sorted_map_remove_and_destroy(t_sorted_map *self, uint64_t key, void(*element_destroyer)(void*)) {
+	// Se destruye sólo si la key existía, aunque su elemento sea NULL
+	bool removed;
+	void *element = sorted_map_remove_key(self, key, &removed);
+	if (removed) {
+		element_destroyer(element);
+	}
+}
+
+void *sorted_map_floor(t_sorted_map *self, uint64_t key, uint64_t *floor_key) {
+	t_sorted_map_node *leaf = sorted_map_find_leaf(self, key);
+	int index = sorted_map_upper_bound(leaf, key) - 1;
+	if (index < 0) {
+		// Todas las claves de la hoja son mayores: el anterior es el último
+		// de la hoja previa
+		leaf = leaf->previous;
+		if (leaf == NULL) {
+			return NULL;
+		}
+		index = leaf->count - 1;
+	}
+	if (index < 0) {
+		return NULL;
+	}
+	if (floor_key != NULL) {
+		*floor_key = leaf->keys[index];
+	}
+	return leaf->values[index];
+}
+
+void *sorted_map_ceil(t_sorted_map *self, uint64_t key, uint64_t *ceil_key) {
+	t_sorted_map_node *leaf = sorted_map_find_leaf(self, key);
+	int index = sorted_map_lower_bound(leaf, key);
+	if (index == leaf->count) {
+		leaf = leaf->next;
+		index = 0;
+	}
+	if (leaf == NULL || index >= leaf->count) {
+		return NULL;
+	}
+	if (ceil_key != NULL) {
+		*ceil_key = leaf->keys[index];
+	}
+	return leaf->values[index];
+}
+
+void *sorted_map_min(t_sorted_map *self, uint64_t *min_key) {
+	return sorted_map_ceil(self, 0, min_key);
+}
+
+void *sorted_map_max(t_sorted_map *self, uint64_t *max_key) {
+	return sorted_map_floor(self, UINT64_MAX, max_key);
+}
+
+void *sorted_map_remove_min(t_sorted_map *self, uint64_t *min_key) {
+	uint64_t key;
+	if (sorted_map_is_empty(self)) {
+		return NULL;
+	}
+	sorted_map_min(self, &key);
+	if (min_key != NULL) {
+		*min_key = key;
+	}
+	return sorted_map_remove(self, key);
+}
+
+void *sorted_map_remove_max(t_sorted_map *self, uint64_t *max_key) {
+	uint64_t key;
+	if (sorted_map_is_empty(self)) {
+		return NULL;
+	}
+	sorted_map_max(self, &key);
+	if (max_key != NULL) {
+		*max_key = key;
+	}
+	return sorted_map_remove(self, key);
+}
+
+void sorted_map_iterate(t_sorted_map *self, void(*closure)(uint64_t key, void* element)) {
+	sorted_map_iterate_range(self, 0, UINT64_MAX, closure);
+}
+
+void sorted_map_iterate_range(t_sorted_map *self, uint64_t from, uint64_t to, void(*closure)(uint64_t key, void* element)) {
+	if (from > to) {
+		return;
+	}
+	t_sorted_map_node *leaf = sorted_map_find_leaf(self, from);
+	sorted_map_iterate_from(leaf, sorted_map_lower_bound(leaf, from), to, closure);
+}
+
+void sorted_map_clean(t_sorted_map *self) {
+	sorted_map_clean_and_destroy_elements(self, NULL);
+}
+
+void sorted_map_clean_and_destroy_elements(t_sorted_map *self, void(*element_destroyer)(void*)) {
+	sorted_map_destroy_node(self->root, element_destroyer);
+	self->root = sorted_map_create_node(true);
+	self->elements_count = 0;
+}
+
+int sorted_map_size(t_sorted_map *self) {
+	return self->elements_count;
+}
+
+bool sorted_map_is_empty(t_sorted_map *self) {
+	return self->elements_count == 0;
+}
+
+void sorted_map_destroy(t_sorted_map *self) {
+	sorted_map_destroy_and_destroy_elements(self, NULL);
+}
+
+void sorted_map_destroy_and_destroy_elements(t_sorted_map *self, void(*element_destroyer)(void*)) {
+	sorted_map_destroy_node(self->root, element_destroyer);
+	free(self);
+}
+
+/********* PRIVATE FUNCTIONS **************/
+
+static t_sorted_map_node *sorted_map_create_node(bool leaf) {
+	t_sorted_map_node *node = malloc(sizeof(t_sorted_map_node));
+	node->count = 0;
+	node->leaf = leaf;
+	node->previous = NULL;
+	node->next = NULL;
+	return node;
+}
+
+static void sorted_map_destroy_node(t_sorted_map_node *node, void(*element_destroyer)(void*)) {
+	for (int i = 0; i < node->count + (node->leaf ? 0 : 1); i++) {
+		if (!node->leaf) {
+			sorted_map_destroy_node(node->children[i], element_destroyer);
+		} else if (element_destroyer != NULL) {
+			element_destroyer(node->values[i]);
+		}
+	}
+	free(node);
+}
+
+static int sorted_map_lower_bound(t_sorted_map_node *node, uint64_t key) {
+	// Primera posición con una clave mayor o igual a key
+	int low = 0, high = node->count;
+	while (low < high) {
+		int middle = (low + high) / 2;
+		if (node->keys[middle] < key) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+	return low;
+}
+
+static int sorted_map_upper_bound(t_sorted_map_node *node, uint64_t key) {
+	// Primera posición con una clave mayor a key
+	int low = 0, high = node->count;
+	while (low < high) {
+		int middle = (low + high) / 2;
+		if (node->keys[middle] <= key) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+	return low;
+}
+
+static t_sorted_map_node *sorted_map_find_leaf(t_sorted_map *self, uint64_t key) {
+	t_sorted_map_node *node = self->root;
+	while (!node->leaf) {
+		node = node->children[sorted_map_upper_bound(node, key)];
+	}
+	return node;
+}
+
+static t_sorted_map_node *sorted_map_insert(t_sorted_map *self, t_sorted_map_node *node, uint64_t key, void *element, uint64_t *separator) {
+	// Retorna el nuevo hermano derecho si el nodo tuvo que partirse, junto
+	// con la clave que los separa en el padre
+	if (node->leaf) {
+		int index = sorted_map_lower_bound(node, key);
+		if (index < node->count && node->keys[index] == key) {
+			node->values[index] = element;
+			return NULL;
+		}
+
+		t_sorted_map_node *right = NULL;
+		if (node->count == SORTED_MAP_NODE_CAPACITY) {
+			right = sorted_map_split_leaf(node, separator);
+			if (index > node->count) {
+				index -= node->count;
+				node = right;
+			}
+		}
+		memmove(node->keys + index + 1, node->keys + index, (node->count - index) * sizeof(uint64_t));
+		memmove(node->values + index + 1, node->values + index, (node->count - index) * sizeof(void*));
+		node->keys[index] = key;
+		node->values[index] = element;
+		node->count++;
+		self->elements_count++;
+		if (right != NULL) {
+			*separator = right->keys[0];
+		}
+		return right;
+	}
+
+	int index = sorted_map_upper_bound(node, key);
+	uint64_t child_separator;
+	t_sorted_map_node *child = sorted_map_insert(self, node->children[index], key, element, &child_separator);
+	if (child == NULL) {
+		return NULL;
+	}
+
+	t_sorted_map_node *right = NULL;
+	if (node->count == SORTED_MAP_NODE_CAPACITY) {
+		right = sorted_map_split_internal(node, separator);
+		if (index > node->count) {
+			index -= node->count + 1;
+			node = right;
+		}
+	}
+	memmove(node->keys + index + 1, node->keys + index, (node->count - index) * sizeof(uint64_t));
+	memmove(node->children + index + 2, node->children + index + 1, (node->count - index) * sizeof(t_sorted_map_node*));
+	node->keys[index] = child_separator;
+	node->children[index + 1] = child;
+	node->count++;
+	return right;
+}
+
+static t_sorted_map_node *sorted_map_split_leaf(t_sorted_map_node *leaf, uint64_t *separator) {
+	t_sorted_map_node *right = sorted_map_create_node(true);
+	int moved = leaf->count - SORTED_MAP_MIN_COUNT;
+	memcpy(right->keys, leaf->keys + SORTED_MAP_MIN_COUNT, moved * sizeof(uint64_t));
+	memcpy(right->values, leaf->values + SORTED_MAP_MIN_COUNT, moved * sizeof(void*));
+	right->count = moved;
+	leaf->count = SORTED_MAP_MIN_COUNT;
+
+	right->previous = leaf;
+	right->next = leaf->next;
+	if (leaf->next != NULL) {
+		leaf->next->previous = right;
+	}
+	leaf->next = right;
+
+	*separator = right->keys[0];
+	return right;
+}
+
+static t_sorted_map_node *sorted_map_split_internal(t_sorted_map_node *node, uint64_t *separator) {
+	// La clave del medio sube al padre y no queda en ninguno de los dos
+	t_sorted_map_node *right = sorted_map_create_node(false);
+	int moved = node->count - SORTED_MAP_MIN_COUNT - 1;
+	memcpy(right->keys, node->keys + SORTED_MAP_MIN_COUNT + 1, moved * sizeof(uint64_t));
+	memcpy(right->children, node->children + SORTED_MAP_MIN_COUNT + 1, (moved + 1) * sizeof(t_sorted_map_node*));
+	right->count = moved;
+	*separator = node->keys[SORTED_MAP_MIN_COUNT];
+	node->count = SORTED_MAP_MIN_COUNT;
+	return right;
+}
+
+static void *sorted_map_remove_key(t_sorted_map *self, uint64_t key, bool *removed) {
+	*removed = false;
+	void *element = sorted_map_delete(self, self->root, key, removed);
+
+	// La raíz interna que se quedó sin claves se reemplaza por su único hijo
+	if (!self->root->leaf && self->root->count == 0) {
+		t_sorted_map_node *root = self->root;
+		self->root = root->children[0];
+		free(root);
+	}
+	return element;
+}
+
+static void *sorted_map_delete(t_sorted_map *self, t_sorted_map_node *node, uint64_t key, bool *removed) {
+	if (node->leaf) {
+		int index = sorted_map_lower_bound(node, key);
+		if (index == node->count || node->keys[index] != key) {
+			return NULL;
+		}
+		void *element = node->values[index];
+		memmove(node->keys + index, node->keys + index + 1, (node->count - index - 1) * sizeof(uint64_t));
+		memmove(node->values + index, node->values + index + 1, (node->count - index - 1) * sizeof(void*));
+		node->count--;
+		self->elements_count--;
+		*removed = true;
+		return element;
+	}
+
+	// Las claves de los nodos internos pueden quedar desactualizadas luego
+	// de quitar un par, pero siguen separando correctamente a sus hijos
+	int index = sorted_map_upper_bound(node, key);
+	void *element = sorted_map_delete(self, node->children[index], key, removed);
+	if (*removed && node->children[index]->count < SORTED_MAP_MIN_COUNT) {
+		sorted_map_rebalance(node, index);
+	}
+	return element;
+}
+
+static void sorted_map_rebalance(t_sorted_map_node *parent, int index) {
+	// Se toma prestada una clave de un hermano que le sobren, o sino se
+	// fusiona el hijo con uno de ellos
+	t_sorted_map_node *child = parent->children[index];
+	t_sorted_map_node *left = index > 0 ? parent->children[index - 1] : NULL;
+	t_sorted_map_node *right = index < parent->count ? parent->children[index + 1] : NULL;
+
+	if (left != NULL && left->count > SORTED_MAP_MIN_COUNT) {
+		memmove(child->keys + 1, child->keys, child->count * sizeof(uint64_t));
+		if (child->leaf) {
+			memmove(child->values + 1, child->values, child->count * sizeof(void*));
+			child->keys[0] = left->keys[left->count - 1];
+			child->values[0] = left->values[left->count - 1];
+			parent->keys[index - 1] = child->keys[0];
+		} else {
+			memmove(child->children + 1, child->children, (child->count + 1) * sizeof(t_sorted_map_node*));
+			child->keys[0] = parent->keys[index - 1];
+			child->children[0] = left->children[left->count];
+			parent->keys[index - 1] = left->keys[left->count - 1];
+		}
+		left->count--;
+		child->count++;
+	} else if (right != NULL && right->count > SORTED_MAP_MIN_COUNT) {
+		if (child->leaf) {
+			child->keys[child->count] = right->keys[0];
+			child->values[child->count] = right->values[0];
+			memmove(right->values, right->values + 1, (right->count - 1) * sizeof(void*));
+			memmove(right->keys, right->keys + 1, (right->count - 1) * sizeof(uint64_t));
+			parent->keys[index] = right->keys[0];
+		} else {
+			child->keys[child->count] = parent->keys[index];
+			child->children[child->count + 1] = right->children[0];
+			parent->keys[index] = right->keys[0];
+			memmove(right->keys, right->keys + 1, (right->count - 1) * sizeof(uint64_t));
+			memmove(right->children, right->children + 1, right->count * sizeof(t_sorted_map_node*));
+		}
+		right->count--;
+		child->count++;
+	} else if (left != NULL) {
+		sorted_map_merge(parent, index - 1);
+	} else {
+		sorted_map_merge(parent, index);
+	}
+}
+
+static void sorted_map_merge(t_sorted_map_node *parent, int index) {
+	// Fusiona children[index + 1] dentro de children[index]
+	t_sorted_map_node *left = parent->children[index];
+	t_sorted_map_node *right = parent->children[index + 1];
+
+	if (left->leaf) {
+		memcpy(left->keys + left->count, right->keys, right->count * sizeof(uint64_t));
+		memcpy(left->values + left->count, right->values, right->count * sizeof(void*));
+		left->count += right->count;
+		left->next = right->next;
+		if (right->next != NULL) {
+			right->next->previous = left;
+		}
+	} else {
+		left->keys[left->count] = parent->keys[index];
+		memcpy(left->keys + left->count + 1, right->keys, right->count * sizeof(uint64_t));
+		memcpy(left->children + left->count + 1, right->children, (right->count + 1) * sizeof(t_sorted_map_node*));
+		left->count += right->count + 1;
+	}
+	free(right);
+
+	memmove(parent->keys + index, parent->keys + index + 1, (parent->count - index - 1) * sizeof(uint64_t));
+	memmove(parent->children + index + 1, parent->children + index + 2, (parent->count - index - 1) * sizeof(t_sorted_map_node*));
+	parent->count--;
+}
+
+static void sorted_map_iterate_from(t_sorted_map_node *leaf, int index, uint64_t to, void(*closure)(uint64_t, void*)) {
+	for (; leaf != NULL; leaf = leaf->next, index = 0) {
+		for (; index < leaf->count; index++) {
+			if (leaf->keys[index] > to) {
+				return;
+			}
+			closure(leaf->keys[index], leaf->values[index]);
+		}
+	}
+}
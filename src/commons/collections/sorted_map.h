@@ -0,0 +1,216 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SORTED_MAP_H_
+#define SORTED_MAP_H_
+
+	#define SORTED_MAP_NODE_CAPACITY 32
+
+	#include <stdbool.h>
+	#include <stdint.h>
+
+	/**
+	 * @file
+	 * @brief `#include <commons/collections/sorted_map.h>`
+	 */
+
+	/** @cond INCLUDE_INTERNALS */
+	typedef struct t_sorted_map_node {
+		int count;
+		bool leaf;
+		uint64_t keys[SORTED_MAP_NODE_CAPACITY];
+		union {
+			void *values[SORTED_MAP_NODE_CAPACITY];
+			struct t_sorted_map_node *children[SORTED_MAP_NODE_CAPACITY + 1];
+		};
+		// Sólo en las hojas, para recorrerlas en orden sin volver a bajar
+		struct t_sorted_map_node *previous;
+		struct t_sorted_map_node *next;
+	} t_sorted_map_node;
+	/** @endcond */
+
+	/**
+	 * @struct t_sorted_map
+	 * @brief Diccionario entero->puntero que mantiene sus claves ordenadas.
+	 *        Inicializar con `sorted_map_create()`.
+	 *
+	 * Los pares se guardan en un árbol B+ de hasta SORTED_MAP_NODE_CAPACITY
+	 * claves contiguas por nodo, por lo que buscar, agregar y quitar es
+	 * O(log n), y las hojas están enlazadas para recorrer rangos en orden.
+	 * Sirve, por ejemplo, para segmentos ordenados por dirección base o
+	 * huecos libres ordenados por tamaño.
+	 *
+	 * @note Las claves son únicas. Para ordenar por un valor que puede
+	 *       repetirse, como el tamaño de un hueco, se puede combinar con otro
+	 *       que lo desempate: `(uint64_t) size << 32 | base`.
+	 */
+	typedef struct {
+		t_sorted_map_node *root;
+		int elements_count;
+	} t_sorted_map;
+
+	/**
+	 * @brief Crea el diccionario ordenado
+	 * @return Devuelve un puntero al diccionario creado, liberable con:
+	 *         - `sorted_map_destroy()` si se quiere liberar el diccionario
+	 *           pero no los elementos que contiene.
+	 *         - `sorted_map_destroy_and_destroy_elements()` si se quiere
+	 *           liberar el diccionario con los elementos que contiene.
+	 *
+	 * Ejemplo de uso:
+	 * @code
+	 * t_sorted_map* holes = sorted_map_create();
+	 * sorted_map_put(holes, hole->base, hole);
+	 * ...
+	 * // Hueco que contiene a la dirección logical_address
+	 * t_hole* hole = sorted_map_floor(holes, logical_address, NULL);
+	 * @endcode
+	 */
+	t_sorted_map *sorted_map_create(void);
+
+	/**
+	 * @brief Inserta un nuevo par (key->element) al diccionario, en caso de ya
+	 *        existir la key actualiza el elemento.
+	 * @param[in] element El elemento a insertar. Este elemento pasará a pertenecer
+	 *            al diccionario, por lo que no debe ser liberado por fuera de éste.
+	 *
+	 * @warning Tener en cuenta que esto no va a liberar la memoria del `element` original.
+	 */
+	void sorted_map_put(t_sorted_map *, uint64_t key, void *element);
+
+	/**
+	 * @brief Obtiene el elemento asociado a la key, o NULL si no existe.
+	 */
+	void *sorted_map_get(t_sorted_map *, uint64_t key);
+
+	/**
+	 * @brief Retorna true si key se encuentra en el diccionario
+	 */
+	bool sorted_map_has_key(t_sorted_map *, uint64_t key);
+
+	/**
+	 * @brief Remueve un elemento del diccionario y lo retorna, o NULL si la
+	 *        key no existe.
+	 */
+	void *sorted_map_remove(t_sorted_map *, uint64_t key);
+
+	/**
+	 * @brief Remueve un elemento del diccionario y lo destruye.
+	 */
+	void sorted_map_remove_and_destroy(t_sorted_map *, uint64_t key, void(*element_destroyer)(void*));
+
+	/**
+	 * @brief Obtiene el elemento de mayor key menor o igual a `key`.
+	 * @param[out] floor_key Si no es NULL, se guarda la key encontrada.
+	 * @return El elemento encontrado, o NULL si todas las keys son mayores.
+	 */
+	void *sorted_map_floor(t_sorted_map *, uint64_t key, uint64_t *floor_key);
+
+	/**
+	 * @brief Obtiene el elemento de menor key mayor o igual a `key`.
+	 * @param[out] ceil_key Si no es NULL, se guarda la key encontrada.
+	 * @return El elemento encontrado, o NULL si todas las keys son menores.
+	 *
+	 * Ejemplo de uso:
+	 * @code
+	 * // Best fit: el hueco más chico donde entra el segmento
+	 * uint64_t key;
+	 * t_hole* hole = sorted_map_ceil(holes_by_size, (uint64_t) size << 32, &key);
+	 * if (hole != NULL) {
+	 *     sorted_map_remove(holes_by_size, key);
+	 * }
+	 * @endcode
+	 */
+	void *sorted_map_ceil(t_sorted_map *, uint64_t key, uint64_t *ceil_key);
+
+	/**
+	 * @brief Obtiene el elemento de menor key.
+	 * @param[out] min_key Si no es NULL, se guarda la key encontrada.
+	 * @return El elemento, o NULL si el diccionario está vacío.
+	 */
+	void *sorted_map_min(t_sorted_map *, uint64_t *min_key);
+
+	/**
+	 * @brief Obtiene el elemento de mayor key.
+	 * @param[out] max_key Si no es NULL, se guarda la key encontrada.
+	 * @return El elemento, o NULL si el diccionario está vacío.
+	 */
+	void *sorted_map_max(t_sorted_map *, uint64_t *max_key);
+
+	/**
+	 * @brief Remueve el elemento de menor key y lo retorna.
+	 * @param[out] min_key Si no es NULL, se guarda la key removida.
+	 * @return El elemento, o NULL si el diccionario está vacío.
+	 */
+	void *sorted_map_remove_min(t_sorted_map *, uint64_t *min_key);
+
+	/**
+	 * @brief Remueve el elemento de mayor key y lo retorna.
+	 * @param[out] max_key Si no es NULL, se guarda la key removida.
+	 * @return El elemento, o NULL si el diccionario está vacío.
+	 */
+	void *sorted_map_remove_max(t_sorted_map *, uint64_t *max_key);
+
+	/**
+	 * @brief Aplica closure a todos los pares del diccionario, en orden
+	 *        creciente de key.
+	 */
+	void sorted_map_iterate(t_sorted_map *, void(*closure)(uint64_t key, void* element));
+
+	/**
+	 * @brief Aplica closure, en orden creciente de key, a los pares cuya key
+	 *        está entre `from` y `to` inclusive.
+	 *
+	 * Ejemplo de uso:
+	 * @code
+	 * // Segmentos que comienzan dentro de una página
+	 * sorted_map_iterate_range(segments, page_base, page_base + PAGE_SIZE - 1, _invalidate);
+	 * @endcode
+	 */
+	void sorted_map_iterate_range(t_sorted_map *, uint64_t from, uint64_t to, void(*closure)(uint64_t key, void* element));
+
+	/**
+	 * @brief Quita todos los elementos del diccionario
+	 */
+	void sorted_map_clean(t_sorted_map *);
+
+	/**
+	 * @brief Quita todos los elementos del diccionario y los destruye
+	 */
+	void sorted_map_clean_and_destroy_elements(t_sorted_map *, void(*element_destroyer)(void*));
+
+	/**
+	 * @brief Retorna la cantidad de elementos del diccionario
+	 */
+	int sorted_map_size(t_sorted_map *);
+
+	/**
+	 * @brief Retorna true si el diccionario está vacío
+	 */
+	bool sorted_map_is_empty(t_sorted_map *);
+
+	/**
+	 * @brief Destruye el diccionario sin liberar los elementos que contiene
+	 */
+	void sorted_map_destroy(t_sorted_map *);
+
+	/**
+	 * @brief Destruye el diccionario, liberando los elementos que contiene con
+	 *        `element_destroyer`
+	 */
+	void sorted_map_destroy_and_destroy_elements(t_sorted_map *, void(*element_destroyer)(void*));
+
+#endif /* SORTED_MAP_H_ */
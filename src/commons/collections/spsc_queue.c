@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include "spsc_queue.h"
+
+/*
+ * head y tail crecen indefinidamente y se enmascaran al indexar el arreglo,
+ * por lo que tail - head es siempre la cantidad de elementos en espera.
+ *
+ * El productor publica los elementos con una escritura release de tail, que
+ * el consumidor lee con acquire antes de leer el arreglo; y viceversa con
+ * head para los lugares libres. Cada hilo guarda además la última posición
+ * que leyó del otro, y sólo vuelve a leerla cuando con esa copia la cola
+ * parece llena (o vacía), evitando traer la línea de caché del otro hilo en
+ * cada operación.
+ */
+
+static size_t spsc_queue_available_to_push(t_spsc_queue *self, size_t tail, size_t wanted);
+static size_t spsc_queue_available_to_pop(t_spsc_queue *self, size_t head, size_t wanted);
+
+t_spsc_queue *spsc_queue_create(int capacity) {
+	size_t buffer_size = 1;
+	while (buffer_size < (size_t) capacity) {
+		buffer_size *= 2;
+	}
+
+	t_spsc_queue *self = aligned_alloc(SPSC_QUEUE_CACHE_LINE_SIZE, sizeof(t_spsc_queue));
+	atomic_init(&self->head, 0);
+	atomic_init(&self->tail, 0);
+	self->cached_head = 0;
+	self->cached_tail = 0;
+	self->buffer = malloc(buffer_size * sizeof(void*));
+	self->mask = buffer_size - 1;
+	return self;
+}
+
+bool spsc_queue_try_push(t_spsc_queue *self, void *element) {
+	return spsc_queue_push_batch(self, &element, 1) == 1;
+}
+
+int spsc_queue_push_batch(t_spsc_queue *self, void **elements, int count) {
+	if (count <= 0) {
+		return 0;
+	}
+
+	size_t tail = atomic_load_explicit(&self->tail, memory_order_relaxed);
+	size_t pushed = spsc_queue_available_to_push(self, tail, count);
+
+	for (size_t i = 0; i < pushed; i++) {
+		self->buffer[(tail + i) & self->mask] = elements[i];
+	}
+	atomic_store_explicit(&self->tail, tail + pushed, memory_order_release);
+	return pushed;
+}
+
+bool spsc_queue_try_pop(t_spsc_queue *self, void **element) {
+	return spsc_queue_pop_batch(self, element, 1) == 1;
+}
+
+int spsc_queue_pop_batch(t_spsc_queue *self, void **elements, int max_count) {
+	if (max_count <= 0) {
+		return 0;
+	}
+
+	size_t head = atomic_load_explicit(&self->head, memory_order_relaxed);
+	size_t popped = spsc_queue_available_to_pop(self, head, max_count);
+
+	for (size_t i = 0; i < popped; i++) {
+		elements[i] = self->buffer[(head + i) & self->mask];
+	}
+	atomic_store_explicit(&self->head, head + popped, memory_order_release);
+	return popped;
+}
+
+int spsc_queue_size(t_spsc_queue *self) {
+	size_t head = atomic_load_explicit(&self->head, memory_order_acquire);
+	size_t tail = atomic_load_explicit(&self->tail, memory_order_acquire);
+	return tail - head;
+}
+
+bool spsc_queue_is_empty(t_spsc_queue *self) {
+	return spsc_queue_size(self) == 0;
+}
+
+void spsc_queue_destroy(t_spsc_queue *self) {
+	free(self->buffer);
+	free(self);
+}
+
+void spsc_queue_destroy_and_destroy_elements(t_spsc_queue *self, void(*element_destroyer)(void*)) {
+	void *element;
+	while (spsc_queue_try_pop(self, &element)) {
+		element_destroyer(element);
+	}
+	spsc_queue_destroy(self);
+}
+
+/********* PRIVATE FUNCTIONS **************/
+
+static size_t spsc_queue_available_to_push(t_spsc_queue *self, size_t tail, size_t wanted) {
+	size_t capacity = self->mask + 1;
+	if (capacity - (tail - self->cached_head) < wanted) {
+		self->cached_head = atomic_load_explicit(&self->head, memory_order_acquire);
+	}
+	size_t available = capacity - (tail - self->cached_head);
+	return available < wanted ? available : wanted;
+}
+
+static size_t spsc_queue_available_to_pop(t_spsc_queue *self, size_t head, size_t wanted) {
+	if (self->cached_tail - head < wanted) {
+		self->cached_tail = atomic_load_explicit(&self->tail, memory_order_acquire);
+	}
+	size_t available = self->cached_tail - head;
+	return available < wanted ? available : wanted;
+}
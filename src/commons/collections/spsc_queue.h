@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SPSC_QUEUE_H_
+#define SPSC_QUEUE_H_
+
+	#define SPSC_QUEUE_CACHE_LINE_SIZE 64
+
+	#include <stdatomic.h>
+	#include <stdbool.h>
+	#include <stddef.h>
+
+	/**
+	 * @file
+	 * @brief `#include <commons/collections/spsc_queue.h>`
+	 *
+	 * Cola de capacidad fija para comunicar exactamente un hilo productor con
+	 * exactamente un hilo consumidor, sin mutex: cada hilo sólo escribe su
+	 * propia posición del arreglo circular y lee la del otro.
+	 *
+	 * @warning Si más de un hilo agrega o más de un hilo quita elementos, el
+	 *          comportamiento es indefinido. Para esos casos usar
+	 *          `blocking_queue.h`.
+	 */
+
+	/**
+	 * @struct t_spsc_queue
+	 * @brief Cola de un productor y un consumidor. Inicializar con `spsc_queue_create()`
+	 *
+	 * Las posiciones del productor y del consumidor se guardan en líneas de
+	 * caché distintas para que las escrituras de un hilo no invaliden la
+	 * línea que usa el otro.
+	 */
+	typedef struct {
+		// Escrita sólo por el consumidor
+		_Alignas(SPSC_QUEUE_CACHE_LINE_SIZE) atomic_size_t head;
+		size_t cached_tail;
+
+		// Escrita sólo por el productor
+		_Alignas(SPSC_QUEUE_CACHE_LINE_SIZE) atomic_size_t tail;
+		size_t cached_head;
+
+		_Alignas(SPSC_QUEUE_CACHE_LINE_SIZE) void **buffer;
+		size_t mask;
+	} t_spsc_queue;
+
+	/**
+	 * @brief Crea una cola de un productor y un consumidor
+	 * @param capacity: Cantidad máxima de elementos en espera. Se redondea
+	 *                  hacia arriba a una potencia de 2.
+	 * @return Retorna un puntero a la cola creada, liberable con
+	 *         `spsc_queue_destroy()` o `spsc_queue_destroy_and_destroy_elements()`
+	 *         una vez que ambos hilos dejaron de usarla.
+	 */
+	t_spsc_queue *spsc_queue_create(int capacity);
+
+	/**
+	 * @brief Agrega un elemento al final de la cola. Sólo puede ser llamada
+	 *        por el hilo productor.
+	 * @return false si la cola está llena.
+	 */
+	bool spsc_queue_try_push(t_spsc_queue *, void *element);
+
+	/**
+	 * @brief Agrega al final de la cola todos los elementos de `elements` que
+	 *        entren. Sólo puede ser llamada por el hilo productor.
+	 * @return La cantidad de elementos agregados, a partir del primero.
+	 */
+	int spsc_queue_push_batch(t_spsc_queue *, void **elements, int count);
+
+	/**
+	 * @brief Quita el primer elemento de la cola. Sólo puede ser llamada por
+	 *        el hilo consumidor.
+	 * @param[out] element Donde se guarda el elemento extraído.
+	 * @return false si la cola está vacía.
+	 */
+	bool spsc_queue_try_pop(t_spsc_queue *, void **element);
+
+	/**
+	 * @brief Quita hasta `max_count` elementos del principio de la cola. Sólo
+	 *        puede ser llamada por el hilo consumidor.
+	 * @param[out] elements Arreglo con lugar para al menos `max_count` elementos.
+	 * @return La cantidad de elementos extraídos.
+	 */
+	int spsc_queue_pop_batch(t_spsc_queue *, void **elements, int max_count);
+
+	/**
+	 * @brief Retorna la cantidad de elementos en espera.
+	 * @note Si el otro hilo está usando la cola, el valor puede estar
+	 *       desactualizado al momento de usarlo.
+	 */
+	int spsc_queue_size(t_spsc_queue *);
+
+	/**
+	 * @brief Retorna true si no hay elementos en espera.
+	 * @see spsc_queue_size
+	 */
+	bool spsc_queue_is_empty(t_spsc_queue *);
+
+	/**
+	 * @brief Destruye la cola sin liberar los elementos que contiene
+	 */
+	void spsc_queue_destroy(t_spsc_queue *);
+
+	/**
+	 * @brief Destruye la cola, liberando los elementos que contiene con
+	 *        `element_destroyer`
+	 */
+	void spsc_queue_destroy_and_destroy_elements(t_spsc_queue *, void(*element_destroyer)(void*));
+
+#endif /* SPSC_QUEUE_H_ */
@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include "stream.h"
+
+#define STREAM_INITIAL_STAGES 4
+
+typedef struct {
+	void *result;
+	void *(*operation)(void*, void*);
+} t_stream_fold_state;
+
+static t_stream_stage *stream_add_stage(t_stream *self, t_stream_stage_type type);
+static void stream_run(t_stream *self, void (*sink)(void*, void*), void *sink_state);
+static bool stream_process(t_stream *self, void *data, void (*sink)(void*, void*), void *sink_state);
+static void stream_fold_sink(void *state, void *data);
+static void stream_collect_sink(void *state, void *data);
+
+t_stream *stream_of(t_list *list) {
+	t_stream *self = malloc(sizeof(t_stream));
+	self->source = list;
+	self->stages_count = 0;
+	self->stages_capacity = STREAM_INITIAL_STAGES;
+	self->stages = malloc(self->stages_capacity * sizeof(t_stream_stage));
+	return self;
+}
+
+t_stream *stream_filter(t_stream *self, bool(*condition)(void*)) {
+	stream_add_stage(self, STREAM_STAGE_FILTER)->condition = condition;
+	return self;
+}
+
+t_stream *stream_map(t_stream *self, void*(*transformer)(void*)) {
+	stream_add_stage(self, STREAM_STAGE_MAP)->transformer = transformer;
+	return self;
+}
+
+t_stream *stream_take(t_stream *self, int count) {
+	stream_add_stage(self, STREAM_STAGE_TAKE)->remaining = count;
+	return self;
+}
+
+void *stream_fold(t_stream *self, void *seed, void*(*operation)(void*, void*)) {
+	t_stream_fold_state state = { .result = seed, .operation = operation };
+	stream_run(self, stream_fold_sink, &state);
+	stream_destroy(self);
+	return state.result;
+}
+
+t_list *stream_collect(t_stream *self) {
+	t_list *collected = self->source->unrolled ? list_create_unrolled() : list_create_with_pool(self->source->pool);
+	stream_run(self, stream_collect_sink, collected);
+	stream_destroy(self);
+	return collected;
+}
+
+void stream_destroy(t_stream *self) {
+	free(self->stages);
+	free(self);
+}
+
+/********* PRIVATE FUNCTIONS **************/
+
+static t_stream_stage *stream_add_stage(t_stream *self, t_stream_stage_type type) {
+	if (self->stages_count == self->stages_capacity) {
+		self->stages_capacity *= 2;
+		self->stages = realloc(self->stages, self->stages_capacity * sizeof(t_stream_stage));
+	}
+	t_stream_stage *stage = &self->stages[self->stages_count++];
+	stage->type = type;
+	return stage;
+}
+
+static void stream_run(t_stream *self, void (*sink)(void*, void*), void *sink_state) {
+	for (int i = 0; i < self->stages_count; i++) {
+		if (self->stages[i].type == STREAM_STAGE_TAKE && self->stages[i].remaining <= 0) {
+			return;
+		}
+	}
+
+	bool finished = false;
+	if (self->source->unrolled) {
+		for (t_unrolled_link_element *node = self->source->unrolled_head; node != NULL && !finished; node = node->next) {
+			for (int i = 0; i < node->count && !finished; i++) {
+				finished = stream_process(self, node->data[i], sink, sink_state);
+			}
+		}
+		return;
+	}
+	for (t_link_element *element = self->source->head; element != NULL && !finished; element = element->next) {
+		finished = stream_process(self, element->data, sink, sink_state);
+	}
+}
+
+static bool stream_process(t_stream *self, void *data, void (*sink)(void*, void*), void *sink_state) {
+	bool discarded = false;
+	bool finished = false;
+
+	for (int i = 0; i < self->stages_count && !discarded; i++) {
+		t_stream_stage *stage = &self->stages[i];
+		switch (stage->type) {
+		case STREAM_STAGE_FILTER:
+			discarded = !stage->condition(data);
+			break;
+		case STREAM_STAGE_MAP:
+			data = stage->transformer(data);
+			break;
+		case STREAM_STAGE_TAKE:
+			// El elemento que agota la etapa sigue hasta el final, pero
+			// ya no se evalúa ningún otro
+			finished = finished || --stage->remaining == 0;
+			break;
+		}
+	}
+
+	if (!discarded) {
+		sink(sink_state, data);
+	}
+	return finished;
+}
+
+static void stream_fold_sink(void *state, void *data) {
+	t_stream_fold_state *fold = state;
+	fold->result = fold->operation(fold->result, data);
+}
+
+static void stream_collect_sink(void *state, void *data) {
+	list_add(state, data);
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef STREAM_H_
+#define STREAM_H_
+
+	#include "list.h"
+
+	/**
+	 * @file
+	 * @brief `#include <commons/collections/stream.h>`
+	 *
+	 * Recorridos diferidos sobre listas. Las operaciones intermedias
+	 * (`stream_filter()`, `stream_map()`, `stream_take()`) sólo se anotan, y
+	 * recién la operación final (`stream_fold()`, `stream_collect()`) recorre
+	 * la lista una única vez, pasando cada elemento por todas las etapas sin
+	 * armar listas intermedias y cortando apenas no se necesitan más
+	 * elementos.
+	 */
+
+	/** @cond INCLUDE_INTERNALS */
+	typedef enum {
+		STREAM_STAGE_FILTER,
+		STREAM_STAGE_MAP,
+		STREAM_STAGE_TAKE
+	} t_stream_stage_type;
+
+	typedef struct {
+		t_stream_stage_type type;
+		bool (*condition)(void*);
+		void *(*transformer)(void*);
+		int remaining;
+	} t_stream_stage;
+	/** @endcond */
+
+	/**
+	 * @struct t_stream
+	 * @brief Recorrido diferido sobre una lista. Inicializar con `stream_of()`
+	 */
+	typedef struct {
+		t_list *source;
+		t_stream_stage *stages;
+		int stages_count;
+		int stages_capacity;
+	} t_stream;
+
+	/**
+	 * @brief Crea un recorrido diferido sobre los elementos de la lista.
+	 * @return El recorrido creado, que se libera al aplicarle una operación
+	 *         final o con `stream_destroy()`.
+	 *
+	 * @note La lista no debe modificarse hasta aplicar la operación final.
+	 *
+	 * Ejemplo de uso:
+	 * @code
+	 * t_stream* stream = stream_of(people);
+	 * stream = stream_filter(stream, _is_adult);
+	 * stream = stream_map(stream, _get_name);
+	 * stream = stream_take(stream, 10);
+	 * t_list* first_adult_names = stream_collect(stream);
+	 * @endcode
+	 */
+	t_stream *stream_of(t_list *list);
+
+	/**
+	 * @brief Agrega una etapa que descarta los elementos que no cumplen la
+	 *        condición.
+	 * @return El mismo recorrido, para encadenar etapas.
+	 */
+	t_stream *stream_filter(t_stream *, bool(*condition)(void*));
+
+	/**
+	 * @brief Agrega una etapa que transforma cada elemento.
+	 * @return El mismo recorrido, para encadenar etapas.
+	 */
+	t_stream *stream_map(t_stream *, void*(*transformer)(void*));
+
+	/**
+	 * @brief Agrega una etapa que deja pasar sólo los primeros `count`
+	 *        elementos. Una vez que pasaron, el recorrido termina sin evaluar
+	 *        el resto de la lista.
+	 * @return El mismo recorrido, para encadenar etapas.
+	 */
+	t_stream *stream_take(t_stream *, int count);
+
+	/**
+	 * @brief Recorre la lista aplicando las etapas y acumula los elementos
+	 *        resultantes igual que `list_fold()`. Libera el recorrido.
+	 */
+	void *stream_fold(t_stream *, void *seed, void*(*operation)(void*, void*));
+
+	/**
+	 * @brief Recorre la lista aplicando las etapas y retorna una nueva lista
+	 *        con los elementos resultantes. Libera el recorrido.
+	 * @return Una lista que usa el mismo pool de nodos que la original.
+	 */
+	t_list *stream_collect(t_stream *);
+
+	/**
+	 * @brief Libera un recorrido sin aplicarle una operación final.
+	 */
+	void stream_destroy(t_stream *);
+
+#endif /* STREAM_H_ */
@@ -0,0 +1,428 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "vector.h"
+
+static void vector_set_capacity(t_vector *self, int capacity);
+static void vector_ensure_capacity(t_vector *self, int capacity);
+static int vector_clamp_range(t_vector *self, int *start, int count);
+static int vector_get_index_by_condition(t_vector *self, bool(*condition)(void*));
+static int vector_get_sorted_index(t_vector *self, void *data, bool (*comparator)(void*, void*));
+static void vector_merge_sort(void **elements, int size, bool (*comparator)(void*, void*));
+static void* vector_fold_elements(t_vector *self, int start, void* seed, void*(*operation)(void*, void*));
+
+t_vector *vector_create() {
+	t_vector *vector = malloc(sizeof(t_vector));
+	vector->elements = NULL;
+	vector->elements_count = 0;
+	vector->capacity = 0;
+	return vector;
+}
+
+void vector_reserve(t_vector *self, int capacity) {
+	if (capacity > self->capacity) {
+		vector_set_capacity(self, capacity);
+	}
+}
+
+void vector_shrink_to_fit(t_vector *self) {
+	vector_set_capacity(self, self->elements_count);
+}
+
+int vector_add(t_vector *self, void *data) {
+	vector_ensure_capacity(self, self->elements_count + 1);
+	self->elements[self->elements_count] = data;
+	return self->elements_count++;
+}
+
+void vector_add_all(t_vector *self, t_vector *other) {
+	vector_ensure_capacity(self, self->elements_count + other->elements_count);
+	memcpy(self->elements + self->elements_count, other->elements, other->elements_count * sizeof(void*));
+	self->elements_count += other->elements_count;
+}
+
+void *vector_get(t_vector *self, int index) {
+	return self->elements[index];
+}
+
+void vector_add_in_index(t_vector *self, int index, void *data) {
+	vector_ensure_capacity(self, self->elements_count + 1);
+	memmove(self->elements + index + 1, self->elements + index, (self->elements_count - index) * sizeof(void*));
+	self->elements[index] = data;
+	self->elements_count++;
+}
+
+int vector_add_sorted(t_vector *self, void *data, bool (*comparator)(void*, void*)) {
+	int index = vector_get_sorted_index(self, data, comparator);
+	vector_add_in_index(self, index, data);
+	return index;
+}
+
+void *vector_replace(t_vector *self, int index, void *data) {
+	void *old_data = self->elements[index];
+	self->elements[index] = data;
+	return old_data;
+}
+
+void *vector_replace_by_condition(t_vector *self, bool(*condition)(void*), void *element) {
+	int index = vector_get_index_by_condition(self, condition);
+	return index != -1 ? vector_replace(self, index, element) : NULL;
+}
+
+void vector_replace_and_destroy_element(t_vector *self, int index, void *data, void(*element_destroyer)(void*)) {
+	void *old_data = vector_replace(self, index, data);
+	element_destroyer(old_data);
+}
+
+void *vector_find(t_vector *self, bool(*condition)(void*)) {
+	int index = vector_get_index_by_condition(self, condition);
+	return index != -1 ? self->elements[index] : NULL;
+}
+
+void vector_iterate(t_vector *self, void(*closure)(void*)) {
+	for (int i = 0; i < self->elements_count; i++) {
+		closure(self->elements[i]);
+	}
+}
+
+void *vector_remove(t_vector *self, int index) {
+	void *data = self->elements[index];
+	self->elements_count--;
+	memmove(self->elements + index, self->elements + index + 1, (self->elements_count - index) * sizeof(void*));
+	return data;
+}
+
+bool vector_remove_element(t_vector *self, void *element) {
+	bool _is_the_element(void *data) {
+		return element == data;
+	}
+	int index = vector_get_index_by_condition(self, _is_the_element);
+	if (index == -1) {
+		return false;
+	}
+	vector_remove(self, index);
+	return true;
+}
+
+void *vector_remove_by_condition(t_vector *self, bool(*condition)(void*)) {
+	int index = vector_get_index_by_condition(self, condition);
+	return index != -1 ? vector_remove(self, index) : NULL;
+}
+
+void vector_remove_and_destroy_element(t_vector *self, int index, void(*element_destroyer)(void*)) {
+	void *data = vector_remove(self, index);
+	element_destroyer(data);
+}
+
+void vector_remove_and_destroy_by_condition(t_vector *self, bool(*condition)(void*), void(*element_destroyer)(void*)) {
+	void *data = vector_remove_by_condition(self, condition);
+	if (data != NULL) {
+		element_destroyer(data);
+	}
+}
+
+void vector_remove_and_destroy_all_by_condition(t_vector *self, bool(*condition)(void*), void(*element_destroyer)(void*)) {
+	int kept = 0;
+	for (int i = 0; i < self->elements_count; i++) {
+		if (condition(self->elements[i])) {
+			element_destroyer(self->elements[i]);
+		} else {
+			self->elements[kept++] = self->elements[i];
+		}
+	}
+	self->elements_count = kept;
+}
+
+int vector_size(t_vector *self) {
+	return self->elements_count;
+}
+
+bool vector_is_empty(t_vector *self) {
+	return vector_size(self) == 0;
+}
+
+void vector_clean(t_vector *self) {
+	self->elements_count = 0;
+}
+
+void vector_clean_and_destroy_elements(t_vector *self, void(*element_destroyer)(void*)) {
+	vector_iterate(self, element_destroyer);
+	vector_clean(self);
+}
+
+void vector_destroy(t_vector *self) {
+	free(self->elements);
+	free(self);
+}
+
+void vector_destroy_and_destroy_elements(t_vector *self, void(*element_destroyer)(void*)) {
+	vector_iterate(self, element_destroyer);
+	vector_destroy(self);
+}
+
+t_vector *vector_take(t_vector *self, int count) {
+	return vector_slice(self, 0, count);
+}
+
+t_vector *vector_slice(t_vector *self, int start, int count) {
+	t_vector *subvector = vector_create();
+	count = vector_clamp_range(self, &start, count);
+	if (count == 0) {
+		return subvector;
+	}
+	vector_reserve(subvector, count);
+	memcpy(subvector->elements, self->elements + start, count * sizeof(void*));
+	subvector->elements_count = count;
+	return subvector;
+}
+
+t_vector *vector_slice_and_remove(t_vector *self, int start, int count) {
+	count = vector_clamp_range(self, &start, count);
+	t_vector *subvector = vector_slice(self, start, count);
+	if (count == 0) {
+		return subvector;
+	}
+	int end = start + count;
+	memmove(self->elements + start, self->elements + end, (self->elements_count - end) * sizeof(void*));
+	self->elements_count -= subvector->elements_count;
+	return subvector;
+}
+
+t_vector *vector_take_and_remove(t_vector *self, int count) {
+	return vector_slice_and_remove(self, 0, count);
+}
+
+t_vector *vector_filter(t_vector *self, bool(*condition)(void*)) {
+	t_vector *subvector = vector_create();
+	void _add_by_condition(void *data) {
+		if (condition(data)) {
+			vector_add(subvector, data);
+		}
+	}
+	vector_iterate(self, _add_by_condition);
+	return subvector;
+}
+
+t_vector *vector_map(t_vector *self, void*(*transformer)(void*)) {
+	t_vector *subvector = vector_create();
+	vector_reserve(subvector, self->elements_count);
+	for (int i = 0; i < self->elements_count; i++) {
+		subvector->elements[i] = transformer(self->elements[i]);
+	}
+	subvector->elements_count = self->elements_count;
+	return subvector;
+}
+
+t_vector *vector_flatten(t_vector *self) {
+	t_vector *subvector = vector_create();
+	void _flatten_data(t_vector *vector) {
+		vector_add_all(subvector, vector);
+	}
+	vector_iterate(self, (void*) _flatten_data);
+	return subvector;
+}
+
+void vector_sort(t_vector *self, bool (*comparator)(void*, void*)) {
+	vector_merge_sort(self->elements, self->elements_count, comparator);
+}
+
+t_vector *vector_sorted(t_vector *self, bool (*comparator)(void*, void*)) {
+	t_vector *other = vector_duplicate(self);
+	vector_sort(other, comparator);
+	return other;
+}
+
+int vector_count_satisfying(t_vector *self, bool(*condition)(void*)) {
+	int result = 0;
+	void _count_by_condition(void *data) {
+		if (condition(data)) {
+			result++;
+		}
+	}
+	vector_iterate(self, _count_by_condition);
+	return result;
+}
+
+bool vector_any_satisfy(t_vector *self, bool(*condition)(void*)) {
+	return vector_get_index_by_condition(self, condition) != -1;
+}
+
+bool vector_all_satisfy(t_vector *self, bool(*condition)(void*)) {
+	bool _not_satisfy(void *data) {
+		return !condition(data);
+	}
+	return vector_get_index_by_condition(self, _not_satisfy) == -1;
+}
+
+t_vector *vector_duplicate(t_vector *self) {
+	t_vector *duplicated = vector_create();
+	vector_add_all(duplicated, self);
+	return duplicated;
+}
+
+void *vector_fold1(t_vector *self, void* (*operation)(void*, void*)) {
+	return vector_fold_elements(self, 1, self->elements[0], operation);
+}
+
+void *vector_fold(t_vector *self, void *seed, void*(*operation)(void*, void*)) {
+	return vector_fold_elements(self, 0, seed, operation);
+}
+
+void *vector_get_minimum(t_vector *self, void* (*minimum)(void*, void*)) {
+	return vector_fold1(self, minimum);
+}
+
+void *vector_get_maximum(t_vector *self, void* (*maximum)(void*, void*)) {
+	return vector_fold1(self, maximum);
+}
+
+t_vector_iterator *vector_iterator_create(t_vector *vector) {
+	t_vector_iterator *new = malloc(sizeof(t_vector_iterator));
+	new->vector = vector;
+	new->index = -1;
+	return new;
+}
+
+bool vector_iterator_has_next(t_vector_iterator *iterator) {
+	return iterator->index + 1 < iterator->vector->elements_count;
+}
+
+void *vector_iterator_next(t_vector_iterator *iterator) {
+	iterator->index++;
+	return iterator->vector->elements[iterator->index];
+}
+
+int vector_iterator_index(t_vector_iterator *iterator) {
+	return iterator->index;
+}
+
+void vector_iterator_add(t_vector_iterator *iterator, void *data) {
+	iterator->index++;
+	vector_add_in_index(iterator->vector, iterator->index, data);
+}
+
+void vector_iterator_remove(t_vector_iterator *iterator) {
+	vector_remove(iterator->vector, iterator->index);
+	iterator->index--;
+}
+
+void vector_iterator_destroy(t_vector_iterator *iterator) {
+	free(iterator);
+}
+
+/********* PRIVATE FUNCTIONS **************/
+
+static void vector_set_capacity(t_vector *self, int capacity) {
+	if (capacity == 0) {
+		free(self->elements);
+		self->elements = NULL;
+	} else {
+		self->elements = realloc(self->elements, capacity * sizeof(void*));
+	}
+	self->capacity = capacity;
+}
+
+static void vector_ensure_capacity(t_vector *self, int capacity) {
+	if (capacity <= self->capacity) {
+		return;
+	}
+	int new_capacity = self->capacity > 0 ? self->capacity : DEFAULT_VECTOR_INITIAL_CAPACITY;
+	while (new_capacity < capacity) {
+		new_capacity *= 2;
+	}
+	vector_set_capacity(self, new_capacity);
+}
+
+static int vector_clamp_range(t_vector *self, int *start, int count) {
+	// Recorta [start, start + count) a los índices válidos del vector y
+	// retorna la cantidad de elementos que quedan en el rango
+	if (*start < 0) {
+		count += *start;
+		*start = 0;
+	}
+	if (*start >= self->elements_count || count <= 0) {
+		return 0;
+	}
+	return count < self->elements_count - *start ? count : self->elements_count - *start;
+}
+
+static int vector_get_index_by_condition(t_vector *self, bool(*condition)(void*)) {
+	for (int i = 0; i < self->elements_count; i++) {
+		if (condition(self->elements[i])) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+static int vector_get_sorted_index(t_vector *self, void *data, bool (*comparator)(void*, void*)) {
+	int low = 0;
+	int high = self->elements_count;
+	while (low < high) {
+		int middle = low + (high - low) / 2;
+		if (comparator(self->elements[middle], data)) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+	return low;
+}
+
+static void vector_merge_sort(void **elements, int size, bool (*comparator)(void*, void*)) {
+	if (size < 2) {
+		return;
+	}
+	void **buffer = malloc(size * sizeof(void*));
+	void **source = elements;
+	void **destination = buffer;
+
+	for (int width = 1; width < size; width *= 2) {
+		for (int low = 0; low < size; low += 2 * width) {
+			int middle = low + width < size ? low + width : size;
+			int high = low + 2 * width < size ? low + 2 * width : size;
+			int left = low, right = middle, i = low;
+			while (left < middle && right < high) {
+				destination[i++] = comparator(source[left], source[right]) ? source[left++] : source[right++];
+			}
+			while (left < middle) {
+				destination[i++] = source[left++];
+			}
+			while (right < high) {
+				destination[i++] = source[right++];
+			}
+		}
+		void **aux = source;
+		source = destination;
+		destination = aux;
+	}
+
+	if (source != elements) {
+		memcpy(elements, source, size * sizeof(void*));
+	}
+	free(buffer);
+}
+
+static void* vector_fold_elements(t_vector *self, int start, void* seed, void*(*operation)(void*, void*)) {
+	void *result = seed;
+	for (int i = start; i < self->elements_count; i++) {
+		result = operation(result, self->elements[i]);
+	}
+	return result;
+}
@@ -0,0 +1,383 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VECTOR_H_
+#define VECTOR_H_
+
+	#define DEFAULT_VECTOR_INITIAL_CAPACITY 8
+
+	#include <stdbool.h>
+
+	/**
+	 * @file
+	 * @brief `#include <commons/collections/vector.h>`
+	 *
+	 * Arreglo dinámico de punteros con la misma interfaz que `t_list`. A
+	 * diferencia de la lista, acceder, reemplazar o agregar al final por
+	 * índice es O(1), por lo que conviene usarlo cuando se recorre con
+	 * `vector_get()` dentro de un for.
+	 */
+
+	/**
+	 * @struct t_vector
+	 * @brief Estructura de un arreglo dinámico. Inicializar con `vector_create()`
+	 */
+	typedef struct {
+		void **elements;
+		int elements_count;
+		int capacity;
+	} t_vector;
+
+	/**
+	 * @struct t_vector_iterator
+	 * @brief Iterador de vectores. Inicializar con `vector_iterator_create()`
+	 */
+	typedef struct {
+		t_vector *vector;
+		int index;
+	} t_vector_iterator;
+
+	/**
+	 * @brief Crea un vector vacío
+	 * @return Retorna un puntero al vector creado, liberable con:
+	 *         - `vector_destroy()` si se quiere liberar el vector pero no
+	 *           los elementos que contiene.
+	 *         - `vector_destroy_and_destroy_elements()` si se quiere liberar
+	 *           el vector con los elementos que contiene
+	 */
+	t_vector *vector_create(void);
+
+	/**
+	 * @brief Asegura que el vector pueda contener al menos `capacity` elementos
+	 *        sin tener que volver a pedir memoria.
+	 *
+	 * Ejemplo de uso:
+	 * @code
+	 * t_vector* pages = vector_create();
+	 * vector_reserve(pages, 1024);
+	 * for (int i = 0; i < 1024; i++) {
+	 *     vector_add(pages, page_create(i)); // no realiza ningún realloc
+	 * }
+	 * @endcode
+	 */
+	void vector_reserve(t_vector *self, int capacity);
+
+	/**
+	 * @brief Libera la memoria reservada que no está siendo utilizada por
+	 *        ningún elemento.
+	 */
+	void vector_shrink_to_fit(t_vector *self);
+
+	/**
+	 * @brief Agrega un elemento al final del vector
+	 * @param element: El elemento a agregar. Este elemento pasará a pertenecer
+	 *                 al vector, por lo que no debe ser liberado por fuera de éste.
+	 * @return El índice en el que se agregó el elemento
+	 */
+	int vector_add(t_vector *self, void *element);
+
+	/**
+	 * @brief Destruye un vector sin liberar los elementos que contiene
+	 */
+	void vector_destroy(t_vector *self);
+
+	/**
+	 * @brief Destruye un vector y sus elementos contenidos llamando a la función
+	 *        `element_destroyer` sobre cada uno de ellos.
+	 */
+	void vector_destroy_and_destroy_elements(t_vector *self, void(*element_destroyer)(void*));
+
+	/**
+	 * @brief Agrega un elemento en una posición determinada del vector,
+	 *        desplazando los siguientes una posición hacia el final.
+	 */
+	void vector_add_in_index(t_vector *self, int index, void *element);
+
+	/**
+	 * @brief Agrega un elemento a un vector ordenado, manteniendo el
+	 *        orden definido por el comparador
+	 * @param comparator: Funcion que compara dos elementos. Debe devolver
+	 *                    true si el primer parametro debe aparecer antes que el
+	 *                    segundo en el vector
+	 * @return El índice en el que se agregó el elemento
+	 *
+	 * @note La posición se busca con búsqueda binaria, por lo que el vector
+	 *       debe estar ordenado con el mismo comparador.
+	 */
+	int vector_add_sorted(t_vector *self, void *element, bool (*comparator)(void*, void*));
+
+	/**
+	 * @brief Agrega todos los elementos del segundo vector al final del primero.
+	 *        Dichos elementos pasarán a pertenecer a ambos vectores a la vez.
+	 */
+	void vector_add_all(t_vector *self, t_vector *other);
+
+	/**
+	 * @brief Retorna el contenido de una posición determinada del vector
+	 * @return El elemento en la posición `index`. Este elemento seguirá
+	 *         perteneciendo al vector, por lo que no debe ser liberado.
+	 */
+	void *vector_get(t_vector *self, int index);
+
+	/**
+	 * @brief Retorna el mínimo del vector según el comparador
+	 * @param minimum: Función que recibe dos elementos y retorna el menor
+	 */
+	void *vector_get_minimum(t_vector *self, void* (*minimum)(void*, void*));
+
+	/**
+	 * @brief Retorna el máximo del vector según el comparador
+	 * @param maximum: Función que recibe dos elementos y retorna el mayor
+	 */
+	void *vector_get_maximum(t_vector *self, void* (*maximum)(void*, void*));
+
+	/**
+	 * @brief Retorna un nuevo vector con los primeros n elementos. Los elementos
+	 *        del vector retornado seguirán perteneciendo al vector original.
+	 */
+	t_vector *vector_take(t_vector *self, int count);
+
+	/**
+	 * @brief Retorna un nuevo vector con los n elementos partiendo desde el
+	 *        índice indicado. Los elementos del vector retornado seguirán
+	 *        perteneciendo al vector original.
+	 *
+	 * Sólo se toman los índices del rango que existen en el vector, por lo
+	 * que un `start` negativo o mayor al tamaño no accede fuera del vector.
+	 */
+	t_vector *vector_slice(t_vector *self, int start, int count);
+
+	/**
+	 * @brief Retorna un nuevo vector con los primeros n elementos, eliminando
+	 *        del vector original los elementos retornados.
+	 */
+	t_vector *vector_take_and_remove(t_vector *self, int count);
+
+	/**
+	 * @brief Retorna un nuevo vector con los n elementos partiendo desde el
+	 *        índice indicado, eliminando del vector original los elementos
+	 *        retornados.
+	 *
+	 * Si el rango queda fuera del vector, el vector retornado está vacío y
+	 * el original no se modifica.
+	 * @see vector_slice
+	 */
+	t_vector *vector_slice_and_remove(t_vector *self, int start, int count);
+
+	/**
+	 * @brief Retorna un nuevo vector con los elementos que cumplen la condición
+	 *        recibida por parámetro. Los elementos del vector retornado seguirán
+	 *        perteneciendo al vector original.
+	 */
+	t_vector *vector_filter(t_vector *self, bool(*condition)(void*));
+
+	/**
+	 * @brief Retorna un nuevo vector con los elementos transformados por la
+	 *        función recibida por parámetro.
+	 */
+	t_vector *vector_map(t_vector *self, void*(*transformer)(void*));
+
+	/**
+	 * @brief Retorna un nuevo vector que resulta de aplanar los elementos de los
+	 *        vectores que contiene el vector original.
+	 */
+	t_vector *vector_flatten(t_vector *self);
+
+	/**
+	 * @brief Coloca un elemento en una de la posiciones del vector
+	 * @return El valor reemplazado, que deberá ser liberado por fuera del vector
+	 *         en caso de ser necesario.
+	 */
+	void *vector_replace(t_vector *self, int index, void *element);
+
+	/**
+	 * @brief Coloca un elemento en la posición del primer elemento que cumpla
+	 *        la condición
+	 * @return El valor reemplazado, o NULL si ningún elemento cumple la condición
+	 */
+	void *vector_replace_by_condition(t_vector *self, bool(*condition)(void*), void *element);
+
+	/**
+	 * @brief Coloca un elemento en una de la posiciones del vector y libera el
+	 *        elemento reemplazado con la función `element_destroyer`
+	 */
+	void vector_replace_and_destroy_element(t_vector *self, int index, void *element, void(*element_destroyer)(void*));
+
+	/**
+	 * @brief Remueve un elemento del vector de una determinada posición y lo
+	 *        retorna.
+	 */
+	void *vector_remove(t_vector *self, int index);
+
+	/**
+	 * @brief Remueve al primer elemento del vector que sea igual al recibido
+	 *        por parámetro
+	 * @return true si se encontró y removió el elemento
+	 */
+	bool vector_remove_element(t_vector *self, void *element);
+
+	/**
+	 * @brief Remueve un elemento del vector de una determinada posición y lo
+	 *        libera con la función `element_destroyer`
+	 */
+	void vector_remove_and_destroy_element(t_vector *self, int index, void(*element_destroyer)(void*));
+
+	/**
+	 * @brief Remueve el primer elemento que cumpla la condición y lo retorna
+	 * @return El elemento removido, o NULL si ningún elemento cumple la condición
+	 */
+	void *vector_remove_by_condition(t_vector *self, bool(*condition)(void*));
+
+	/**
+	 * @brief Remueve y destruye el primer elemento que cumpla la condición
+	 */
+	void vector_remove_and_destroy_by_condition(t_vector *self, bool(*condition)(void*), void(*element_destroyer)(void*));
+
+	/**
+	 * @brief Remueve y destruye todos los elementos que cumplan la condición
+	 */
+	void vector_remove_and_destroy_all_by_condition(t_vector *self, bool(*condition)(void*), void(*element_destroyer)(void*));
+
+	/**
+	 * @brief Quita todos los elementos del vector sin liberarlos
+	 * @note La memoria reservada se conserva para reutilizarla.
+	 */
+	void vector_clean(t_vector *self);
+
+	/**
+	 * @brief Quita y destruye todos los elementos del vector
+	 */
+	void vector_clean_and_destroy_elements(t_vector *self, void(*element_destroyer)(void*));
+
+	/**
+	 * @brief Itera el vector llamando al closure por cada elemento
+	 */
+	void vector_iterate(t_vector *self, void(*closure)(void*));
+
+	/**
+	 * @brief Retorna el primer valor encontrado que haga que `condition`
+	 *        devuelva true, o NULL si ningún elemento la cumple
+	 */
+	void *vector_find(t_vector *self, bool(*condition)(void*));
+
+	/**
+	 * @brief Retorna el tamaño del vector
+	 */
+	int vector_size(t_vector *self);
+
+	/**
+	 * @brief Verifica si el vector esta vacío
+	 */
+	bool vector_is_empty(t_vector *self);
+
+	/**
+	 * @brief Ordena el vector según el comparador
+	 * @param comparator: Funcion que compara dos elementos. Debe devolver
+	 *                    true si el primer parametro debe aparecer antes que el
+	 *                    segundo en el vector
+	 *
+	 * @note El ordenamiento es estable y se realiza en O(n log n)
+	 */
+	void vector_sort(t_vector *self, bool (*comparator)(void*, void*));
+
+	/**
+	 * @brief Retorna un vector nuevo ordenado según el comparador. Los
+	 *        elementos del vector retornado seguirán perteneciendo al
+	 *        vector original.
+	 */
+	t_vector *vector_sorted(t_vector *self, bool (*comparator)(void*, void*));
+
+	/**
+	 * @brief Cuenta la cantidad de elementos del vector que cumplen la condición
+	 */
+	int vector_count_satisfying(t_vector *self, bool(*condition)(void*));
+
+	/**
+	 * @brief Determina si algún elemento del vector cumple la condición
+	 */
+	bool vector_any_satisfy(t_vector *self, bool(*condition)(void*));
+
+	/**
+	 * @brief Determina si todos los elementos del vector cumplen la condición
+	 */
+	bool vector_all_satisfy(t_vector *self, bool(*condition)(void*));
+
+	/**
+	 * @brief Crea un vector nuevo con los mismos elementos que el original.
+	 *        Los elementos del vector retornado seguirán perteneciendo al
+	 *        vector original.
+	 */
+	t_vector *vector_duplicate(t_vector *self);
+
+	/**
+	 * @brief Devuelve un valor que resulta de aplicar la operacion entre todos
+	 *        los elementos del vector, partiendo desde el primero.
+	 * @param seed: Valor inicial para el primer parámetro de la operación.
+	 */
+	void *vector_fold(t_vector *self, void *seed, void*(*operation)(void*, void*));
+
+	/**
+	 * @brief Devuelve un valor que resulta de aplicar la operacion entre todos
+	 *        los elementos del vector, tomando al primero como semilla y
+	 *        partiendo desde el segundo (si existe).
+	 */
+	void *vector_fold1(t_vector *self, void* (*operation)(void*, void*));
+
+	/**
+	 * @brief Inicializa una iteración externa del vector. Permite recorrer
+	 *        el vector y modificarlo al mismo tiempo.
+	 * @return Un puntero que debe ser liberado con `vector_iterator_destroy()`
+	 *         una vez finalizada la iteración.
+	 */
+	t_vector_iterator *vector_iterator_create(t_vector *vector);
+
+	/**
+	 * @brief Devuelve true si quedan elementos del vector por recorrer
+	 */
+	bool vector_iterator_has_next(t_vector_iterator *iterator);
+
+	/**
+	 * @brief Avanza hacia el siguiente elemento a iterar del vector y
+	 *        lo devuelve
+	 */
+	void *vector_iterator_next(t_vector_iterator *iterator);
+
+	/**
+	 * @brief Devuelve el índice del elemento actual de la iteración
+	 */
+	int vector_iterator_index(t_vector_iterator *iterator);
+
+	/**
+	 * @brief Agrega al vector un elemento delante del actual y detrás
+	 *        del siguiente. Luego, avanza hacia el elemento agregado.
+	 */
+	void vector_iterator_add(t_vector_iterator *iterator, void *data);
+
+	/**
+	 * @brief Remueve del vector al elemento actual de la iteración
+	 * @note El elemento removido es el último devuelto por `vector_iterator_next()`
+	 *       y dejará de pertenecer al vector, por lo que debe ser liberado
+	 *       una vez que no se lo necesite.
+	 */
+	void vector_iterator_remove(t_vector_iterator *iterator);
+
+	/**
+	 * @brief Finaliza la instancia de iteración externa liberando sus recursos
+	 * @note Esta operación no libera el vector ni sus elementos.
+	 */
+	void vector_iterator_destroy(t_vector_iterator *iterator);
+
+#endif /*VECTOR_H_*/
@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include "work_stealing_deque.h"
+
+/*
+ * Versión para C11 del deque de Chase-Lev (Lê, Pop, Cohen y Zappa Nardelli,
+ * 2013). Los elementos vivos son los de las posiciones [top, bottom): el
+ * dueño mueve bottom y los ladrones avanzan top con un compare-and-swap.
+ * Cuando queda un único elemento, el dueño también compite por top.
+ *
+ * Los arreglos reemplazados al crecer no se liberan hasta destruir el deque,
+ * porque algún ladrón podría estar leyéndolos todavía.
+ */
+
+static t_work_stealing_array *work_stealing_array_create(int64_t capacity, t_work_stealing_array *previous);
+static t_work_stealing_array *work_stealing_deque_grow(t_work_stealing_deque *self, t_work_stealing_array *array, int64_t top, int64_t bottom);
+
+t_work_stealing_deque *work_stealing_deque_create(int initial_capacity) {
+	int64_t capacity = 2;
+	while (capacity < initial_capacity) {
+		capacity *= 2;
+	}
+
+	t_work_stealing_deque *self = aligned_alloc(WORK_STEALING_DEQUE_CACHE_LINE_SIZE, sizeof(t_work_stealing_deque));
+	atomic_init(&self->top, 0);
+	atomic_init(&self->bottom, 0);
+	atomic_init(&self->array, work_stealing_array_create(capacity, NULL));
+	return self;
+}
+
+void work_stealing_deque_push(t_work_stealing_deque *self, void *element) {
+	int64_t bottom = atomic_load_explicit(&self->bottom, memory_order_relaxed);
+	int64_t top = atomic_load_explicit(&self->top, memory_order_acquire);
+	t_work_stealing_array *array = atomic_load_explicit(&self->array, memory_order_relaxed);
+
+	if (bottom - top > array->capacity - 1) {
+		array = work_stealing_deque_grow(self, array, top, bottom);
+	}
+	atomic_store_explicit(&array->elements[bottom & (array->capacity - 1)], element, memory_order_relaxed);
+	atomic_store_explicit(&self->bottom, bottom + 1, memory_order_release);
+}
+
+bool work_stealing_deque_pop(t_work_stealing_deque *self, void **element) {
+	int64_t bottom = atomic_load_explicit(&self->bottom, memory_order_relaxed) - 1;
+	t_work_stealing_array *array = atomic_load_explicit(&self->array, memory_order_relaxed);
+	atomic_store_explicit(&self->bottom, bottom, memory_order_seq_cst);
+	int64_t top = atomic_load_explicit(&self->top, memory_order_seq_cst);
+
+	if (top > bottom) {
+		atomic_store_explicit(&self->bottom, bottom + 1, memory_order_relaxed);
+		return false;
+	}
+
+	*element = atomic_load_explicit(&array->elements[bottom & (array->capacity - 1)], memory_order_relaxed);
+	if (top < bottom) {
+		return true;
+	}
+
+	// Era el último elemento: se compite con los ladrones por él
+	bool won = atomic_compare_exchange_strong_explicit(&self->top, &top, top + 1,
+			memory_order_seq_cst, memory_order_relaxed);
+	atomic_store_explicit(&self->bottom, bottom + 1, memory_order_relaxed);
+	return won;
+}
+
+bool work_stealing_deque_steal(t_work_stealing_deque *self, void **element) {
+	int64_t top = atomic_load_explicit(&self->top, memory_order_seq_cst);
+	int64_t bottom = atomic_load_explicit(&self->bottom, memory_order_seq_cst);
+	if (top >= bottom) {
+		return false;
+	}
+
+	t_work_stealing_array *array = atomic_load_explicit(&self->array, memory_order_acquire);
+	void *stolen = atomic_load_explicit(&array->elements[top & (array->capacity - 1)], memory_order_relaxed);
+	if (!atomic_compare_exchange_strong_explicit(&self->top, &top, top + 1,
+			memory_order_seq_cst, memory_order_relaxed)) {
+		return false;
+	}
+	*element = stolen;
+	return true;
+}
+
+int work_stealing_deque_size(t_work_stealing_deque *self) {
+	int64_t bottom = atomic_load(&self->bottom);
+	int64_t top = atomic_load(&self->top);
+	return bottom > top ? bottom - top : 0;
+}
+
+void work_stealing_deque_destroy(t_work_stealing_deque *self) {
+	t_work_stealing_array *array = atomic_load(&self->array);
+	while (array != NULL) {
+		t_work_stealing_array *previous = array->previous;
+		free(array);
+		array = previous;
+	}
+	free(self);
+}
+
+/********* PRIVATE FUNCTIONS **************/
+
+static t_work_stealing_array *work_stealing_array_create(int64_t capacity, t_work_stealing_array *previous) {
+	t_work_stealing_array *array = malloc(sizeof(t_work_stealing_array) + capacity * sizeof(_Atomic(void*)));
+	array->capacity = capacity;
+	array->previous = previous;
+	return array;
+}
+
+static t_work_stealing_array *work_stealing_deque_grow(t_work_stealing_deque *self, t_work_stealing_array *array, int64_t top, int64_t bottom) {
+	t_work_stealing_array *grown = work_stealing_array_create(array->capacity * 2, array);
+	for (int64_t i = top; i < bottom; i++) {
+		void *element = atomic_load_explicit(&array->elements[i & (array->capacity - 1)], memory_order_relaxed);
+		atomic_store_explicit(&grown->elements[i & (grown->capacity - 1)], element, memory_order_relaxed);
+	}
+	atomic_store_explicit(&self->array, grown, memory_order_release);
+	return grown;
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef WORK_STEALING_DEQUE_H_
+#define WORK_STEALING_DEQUE_H_
+
+	#define WORK_STEALING_DEQUE_CACHE_LINE_SIZE 64
+	#define DEFAULT_WORK_STEALING_DEQUE_INITIAL_CAPACITY 64
+
+	#include <stdatomic.h>
+	#include <stdbool.h>
+	#include <stdint.h>
+
+	/**
+	 * @file
+	 * @brief `#include <commons/collections/work_stealing_deque.h>`
+	 *
+	 * Deque de Chase-Lev para repartir trabajo entre hilos. Un único hilo,
+	 * el dueño, agrega y quita elementos por el final sin competir con
+	 * nadie mientras quede más de un elemento. El resto de los hilos pueden
+	 * robar elementos del principio, compitiendo sólo entre ellos o por el
+	 * último elemento.
+	 */
+
+	/** @cond INCLUDE_INTERNALS */
+	typedef struct t_work_stealing_array {
+		int64_t capacity;
+		struct t_work_stealing_array *previous;
+		_Atomic(void*) elements[];
+	} t_work_stealing_array;
+	/** @endcond */
+
+	/**
+	 * @struct t_work_stealing_deque
+	 * @brief Deque con robo de trabajo. Inicializar con
+	 *        `work_stealing_deque_create()`
+	 */
+	typedef struct {
+		_Alignas(WORK_STEALING_DEQUE_CACHE_LINE_SIZE) _Atomic int64_t top;
+		_Alignas(WORK_STEALING_DEQUE_CACHE_LINE_SIZE) _Atomic int64_t bottom;
+		_Atomic(t_work_stealing_array*) array;
+	} t_work_stealing_deque;
+
+	/**
+	 * @brief Crea un deque con robo de trabajo
+	 * @param initial_capacity: Capacidad inicial, que se redondea hacia
+	 *                          arriba a una potencia de 2. El deque crece
+	 *                          solo cuando se llena.
+	 * @return Retorna un puntero al deque creado, liberable con
+	 *         `work_stealing_deque_destroy()` una vez que ningún hilo lo usa.
+	 */
+	t_work_stealing_deque *work_stealing_deque_create(int initial_capacity);
+
+	/**
+	 * @brief Agrega un elemento al final del deque.
+	 * @warning Sólo puede ser llamada por el hilo dueño del deque.
+	 */
+	void work_stealing_deque_push(t_work_stealing_deque *, void *element);
+
+	/**
+	 * @brief Quita el último elemento agregado.
+	 * @param[out] element Donde se guarda el elemento extraído.
+	 * @return false si el deque está vacío.
+	 * @warning Sólo puede ser llamada por el hilo dueño del deque.
+	 */
+	bool work_stealing_deque_pop(t_work_stealing_deque *, void **element);
+
+	/**
+	 * @brief Roba el elemento más antiguo del deque. Puede ser llamada por
+	 *        cualquier hilo.
+	 * @param[out] element Donde se guarda el elemento extraído.
+	 * @return false si el deque está vacío o si otro hilo se llevó el
+	 *         elemento primero, en cuyo caso se puede volver a intentar.
+	 */
+	bool work_stealing_deque_steal(t_work_stealing_deque *, void **element);
+
+	/**
+	 * @brief Retorna la cantidad aproximada de elementos en el deque.
+	 */
+	int work_stealing_deque_size(t_work_stealing_deque *);
+
+	/**
+	 * @brief Destruye el deque sin liberar los elementos que contiene
+	 */
+	void work_stealing_deque_destroy(t_work_stealing_deque *);
+
+#endif /* WORK_STEALING_DEQUE_H_ */
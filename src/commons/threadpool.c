@@ -0,0 +1,351 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define _GNU_SOURCE
+
+#include <stdlib.h>
+#include <sched.h>
+#include <unistd.h>
+#include "threadpool.h"
+
+#define THREADPOOL_JOIN_ATTEMPTS 16
+
+// Hilo del pool que está ejecutando el código actual, o NULL si es un hilo
+// ajeno a cualquier pool
+static __thread t_threadpool_worker *current_worker;
+
+static t_threadpool *threadpool_create_internal(int threads, bool pinned);
+static int threadpool_allowed_cpus(int *cpus);
+static void threadpool_start_worker(t_threadpool_worker *worker, int cpu);
+static void *threadpool_worker_loop(void *worker);
+static t_future *threadpool_find_task(t_threadpool_worker *worker);
+static t_future *threadpool_take_submitted(t_threadpool *self);
+static t_future *threadpool_steal(t_threadpool_worker *worker);
+static bool threadpool_has_work(t_threadpool *self);
+static void threadpool_run(t_threadpool *self, t_future *task);
+static void threadpool_wake_worker(t_threadpool *self);
+static void threadpool_wait_for_work_or_completion(t_threadpool *self, t_future *future);
+static bool threadpool_is_current_worker(t_threadpool *self);
+
+t_threadpool *threadpool_create(int threads) {
+	return threadpool_create_internal(threads, false);
+}
+
+t_threadpool *threadpool_create_pinned(int threads) {
+	return threadpool_create_internal(threads, true);
+}
+
+t_future *threadpool_submit(t_threadpool *self, void *(*function)(void*), void *argument) {
+	t_future *task = malloc(sizeof(t_future));
+	task->function = function;
+	task->argument = argument;
+	task->result = NULL;
+	atomic_init(&task->done, false);
+
+	if (threadpool_is_current_worker(self)) {
+		work_stealing_deque_push(current_worker->tasks, task);
+		threadpool_wake_worker(self);
+		return task;
+	}
+
+	pthread_mutex_lock(&self->mutex);
+	queue_push(self->submitted, task);
+	atomic_fetch_add(&self->submitted_count, 1);
+	pthread_cond_signal(&self->work_available);
+	if (atomic_load(&self->waiting_workers) > 0) {
+		pthread_cond_broadcast(&self->task_completed);
+	}
+	pthread_mutex_unlock(&self->mutex);
+	return task;
+}
+
+void *threadpool_join(t_threadpool *self, t_future *future) {
+	if (threadpool_is_current_worker(self)) {
+		// Bloquear a un hilo del pool podría dejarlo sin hilos para ejecutar
+		// la tarea esperada, así que mientras tanto ejecuta otras. Si no
+		// encuentra ninguna, la tarea la está ejecutando otro hilo y se
+		// duerme hasta que termine o aparezca trabajo nuevo.
+		int failed_attempts = 0;
+		while (!atomic_load_explicit(&future->done, memory_order_acquire)) {
+			t_future *task = threadpool_find_task(current_worker);
+			if (task != NULL) {
+				threadpool_run(self, task);
+				failed_attempts = 0;
+			} else if (++failed_attempts < THREADPOOL_JOIN_ATTEMPTS) {
+				sched_yield();
+			} else {
+				threadpool_wait_for_work_or_completion(self, future);
+				failed_attempts = 0;
+			}
+		}
+	} else if (!atomic_load_explicit(&future->done, memory_order_acquire)) {
+		pthread_mutex_lock(&self->mutex);
+		atomic_fetch_add(&self->waiting_joiners, 1);
+		while (!atomic_load(&future->done)) {
+			pthread_cond_wait(&self->task_completed, &self->mutex);
+		}
+		atomic_fetch_sub(&self->waiting_joiners, 1);
+		pthread_mutex_unlock(&self->mutex);
+	}
+
+	void *result = future->result;
+	free(future);
+	return result;
+}
+
+bool threadpool_future_is_done(t_future *future) {
+	return atomic_load_explicit(&future->done, memory_order_acquire);
+}
+
+int threadpool_size(t_threadpool *self) {
+	return self->workers_count;
+}
+
+void threadpool_destroy(t_threadpool *self) {
+	pthread_mutex_lock(&self->mutex);
+	atomic_store(&self->shutting_down, true);
+	pthread_cond_broadcast(&self->work_available);
+	pthread_mutex_unlock(&self->mutex);
+
+	for (int i = 0; i < self->workers_count; i++) {
+		pthread_join(self->workers[i].thread, NULL);
+	}
+	for (int i = 0; i < self->workers_count; i++) {
+		work_stealing_deque_destroy(self->workers[i].tasks);
+	}
+
+	queue_destroy(self->submitted);
+	pthread_cond_destroy(&self->work_available);
+	pthread_cond_destroy(&self->task_completed);
+	pthread_mutex_destroy(&self->mutex);
+	free(self->workers);
+	free(self);
+}
+
+/********* PRIVATE FUNCTIONS **************/
+
+static t_threadpool *threadpool_create_internal(int threads, bool pinned) {
+	int cpus[CPU_SETSIZE];
+	int cpus_count = threadpool_allowed_cpus(cpus);
+	if (threads < 1) {
+		threads = cpus_count > 0 ? cpus_count : sysconf(_SC_NPROCESSORS_ONLN);
+	}
+
+	t_threadpool *self = malloc(sizeof(t_threadpool));
+	self->workers_count = threads;
+	self->workers = malloc(threads * sizeof(t_threadpool_worker));
+	self->submitted = queue_create();
+	atomic_init(&self->submitted_count, 0);
+	atomic_init(&self->sleeping_workers, 0);
+	atomic_init(&self->waiting_joiners, 0);
+	atomic_init(&self->waiting_workers, 0);
+	atomic_init(&self->shutting_down, false);
+	pthread_mutex_init(&self->mutex, NULL);
+	pthread_cond_init(&self->work_available, NULL);
+	pthread_cond_init(&self->task_completed, NULL);
+
+	// Los deques se crean antes que los hilos porque cualquiera de ellos
+	// puede empezar a robar apenas arranca
+	for (int i = 0; i < threads; i++) {
+		self->workers[i].id = i;
+		self->workers[i].random_state = 2654435761u * (i + 1);
+		self->workers[i].tasks = work_stealing_deque_create(DEFAULT_WORK_STEALING_DEQUE_INITIAL_CAPACITY);
+		self->workers[i].pool = self;
+	}
+
+	for (int i = 0; i < threads; i++) {
+		int cpu = pinned && cpus_count > 0 ? cpus[i % cpus_count] : -1;
+		threadpool_start_worker(&self->workers[i], cpu);
+	}
+
+	return self;
+}
+
+static int threadpool_allowed_cpus(int *cpus) {
+	// Los ids de las CPUs permitidas pueden no ser 0..n-1, por ejemplo si el
+	// proceso está restringido con taskset o un cpuset
+	cpu_set_t allowed;
+	if (sched_getaffinity(0, sizeof(cpu_set_t), &allowed) != 0) {
+		return 0;
+	}
+
+	int count = 0;
+	for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+		if (CPU_ISSET(cpu, &allowed)) {
+			cpus[count++] = cpu;
+		}
+	}
+	return count;
+}
+
+static void threadpool_start_worker(t_threadpool_worker *worker, int cpu) {
+	// La afinidad se fija antes de crear el hilo para que nunca corra fuera
+	// de su CPU. Si no se puede fijar, el hilo se crea sin fijar.
+	if (cpu != -1) {
+		pthread_attr_t attributes;
+		pthread_attr_init(&attributes);
+		cpu_set_t cpu_set;
+		CPU_ZERO(&cpu_set);
+		CPU_SET(cpu, &cpu_set);
+		bool created = pthread_attr_setaffinity_np(&attributes, sizeof(cpu_set_t), &cpu_set) == 0
+				&& pthread_create(&worker->thread, &attributes, threadpool_worker_loop, worker) == 0;
+		pthread_attr_destroy(&attributes);
+		if (created) {
+			return;
+		}
+	}
+	pthread_create(&worker->thread, NULL, threadpool_worker_loop, worker);
+}
+
+static void *threadpool_worker_loop(void *worker) {
+	current_worker = worker;
+	t_threadpool *self = current_worker->pool;
+
+	while (true) {
+		t_future *task = threadpool_find_task(current_worker);
+		if (task != NULL) {
+			threadpool_run(self, task);
+			continue;
+		}
+
+		// Se anota como dormido antes de volver a buscar trabajo: quien
+		// agregue una tarea después de la búsqueda lo va a ver y despertar
+		pthread_mutex_lock(&self->mutex);
+		atomic_fetch_add(&self->sleeping_workers, 1);
+		bool finished = false;
+		if (!threadpool_has_work(self)) {
+			if (atomic_load(&self->shutting_down)) {
+				finished = true;
+			} else {
+				pthread_cond_wait(&self->work_available, &self->mutex);
+			}
+		}
+		atomic_fetch_sub(&self->sleeping_workers, 1);
+		pthread_mutex_unlock(&self->mutex);
+
+		if (finished) {
+			break;
+		}
+	}
+
+	return NULL;
+}
+
+static t_future *threadpool_find_task(t_threadpool_worker *worker) {
+	void *task;
+	if (work_stealing_deque_pop(worker->tasks, &task)) {
+		return task;
+	}
+
+	task = threadpool_take_submitted(worker->pool);
+	if (task != NULL) {
+		return task;
+	}
+
+	return threadpool_steal(worker);
+}
+
+static t_future *threadpool_take_submitted(t_threadpool *self) {
+	if (atomic_load(&self->submitted_count) == 0) {
+		return NULL;
+	}
+
+	pthread_mutex_lock(&self->mutex);
+	t_future *task = queue_pop(self->submitted);
+	if (task != NULL) {
+		atomic_fetch_sub(&self->submitted_count, 1);
+	}
+	pthread_mutex_unlock(&self->mutex);
+	return task;
+}
+
+static t_future *threadpool_steal(t_threadpool_worker *worker) {
+	t_threadpool *self = worker->pool;
+
+	// Se empieza por una víctima al azar para no robarle siempre al mismo
+	worker->random_state ^= worker->random_state << 13;
+	worker->random_state ^= worker->random_state >> 17;
+	worker->random_state ^= worker->random_state << 5;
+	int first_victim = worker->random_state % self->workers_count;
+
+	for (int i = 0; i < self->workers_count; i++) {
+		t_threadpool_worker *victim = &self->workers[(first_victim + i) % self->workers_count];
+		void *task;
+		if (victim != worker && work_stealing_deque_steal(victim->tasks, &task)) {
+			return task;
+		}
+	}
+	return NULL;
+}
+
+static bool threadpool_has_work(t_threadpool *self) {
+	if (atomic_load(&self->submitted_count) > 0) {
+		return true;
+	}
+	for (int i = 0; i < self->workers_count; i++) {
+		if (work_stealing_deque_size(self->workers[i].tasks) > 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static void threadpool_run(t_threadpool *self, t_future *task) {
+	task->result = task->function(task->argument);
+	atomic_store(&task->done, true);
+
+	if (atomic_load(&self->waiting_joiners) > 0) {
+		pthread_mutex_lock(&self->mutex);
+		pthread_cond_broadcast(&self->task_completed);
+		pthread_mutex_unlock(&self->mutex);
+	}
+}
+
+static void threadpool_wake_worker(t_threadpool *self) {
+	// La barrera ordena el push al deque antes de leer los dormidos: un hilo
+	// que se anotó como dormido antes ve la tarea nueva o es despertado acá
+	atomic_thread_fence(memory_order_seq_cst);
+	bool sleeping = atomic_load(&self->sleeping_workers) > 0;
+	bool waiting = atomic_load(&self->waiting_workers) > 0;
+	if (sleeping || waiting) {
+		pthread_mutex_lock(&self->mutex);
+		if (sleeping) {
+			pthread_cond_signal(&self->work_available);
+		}
+		if (waiting) {
+			pthread_cond_broadcast(&self->task_completed);
+		}
+		pthread_mutex_unlock(&self->mutex);
+	}
+}
+
+static void threadpool_wait_for_work_or_completion(t_threadpool *self, t_future *future) {
+	// Igual que un hilo dormido, se anota antes de volver a revisar: quien
+	// termine la tarea o agregue otra después lo va a ver y despertar
+	pthread_mutex_lock(&self->mutex);
+	atomic_fetch_add(&self->waiting_joiners, 1);
+	atomic_fetch_add(&self->waiting_workers, 1);
+	while (!atomic_load(&future->done) && !threadpool_has_work(self)) {
+		pthread_cond_wait(&self->task_completed, &self->mutex);
+	}
+	atomic_fetch_sub(&self->waiting_workers, 1);
+	atomic_fetch_sub(&self->waiting_joiners, 1);
+	pthread_mutex_unlock(&self->mutex);
+}
+
+static bool threadpool_is_current_worker(t_threadpool *self) {
+	return current_worker != NULL && current_worker->pool == self;
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef THREADPOOL_H_
+#define THREADPOOL_H_
+
+	#include <pthread.h>
+	#include <stdatomic.h>
+	#include <stdbool.h>
+	#include <stdint.h>
+	#include "collections/queue.h"
+	#include "collections/work_stealing_deque.h"
+
+	/**
+	 * @file
+	 * @brief `#include <commons/threadpool.h>`
+	 *
+	 * Pool de hilos de tamaño fijo. Cada hilo tiene su propio deque de
+	 * tareas (ver `work_stealing_deque.h`): las tareas que envía un hilo del
+	 * pool van a su deque, y los hilos que se quedan sin trabajo se lo roban
+	 * a los demás. Las tareas enviadas desde hilos ajenos al pool pasan por
+	 * una cola compartida.
+	 */
+
+	/**
+	 * @struct t_future
+	 * @brief Resultado pendiente de una tarea. Se obtiene con
+	 *        `threadpool_submit()` y se libera con `threadpool_join()`.
+	 */
+	typedef struct {
+		void *(*function)(void*);
+		void *argument;
+		void *result;
+		atomic_bool done;
+	} t_future;
+
+	/** @cond INCLUDE_INTERNALS */
+	typedef struct {
+		pthread_t thread;
+		int id;
+		uint32_t random_state;
+		t_work_stealing_deque *tasks;
+		struct t_threadpool *pool;
+	} t_threadpool_worker;
+	/** @endcond */
+
+	/**
+	 * @struct t_threadpool
+	 * @brief Pool de hilos. Inicializar con `threadpool_create()`
+	 */
+	typedef struct t_threadpool {
+		t_threadpool_worker *workers;
+		int workers_count;
+		t_queue *submitted;
+		atomic_int submitted_count;
+		pthread_mutex_t mutex;
+		pthread_cond_t work_available;
+		pthread_cond_t task_completed;
+		atomic_int sleeping_workers;
+		atomic_int waiting_joiners;
+		atomic_int waiting_workers;
+		atomic_bool shutting_down;
+	} t_threadpool;
+
+	/**
+	 * @brief Crea un pool de hilos
+	 * @param threads: Cantidad de hilos del pool. Si es menor a 1, se crea un
+	 *                 hilo por cada CPU disponible.
+	 * @return Retorna un puntero al pool creado, liberable con
+	 *         `threadpool_destroy()`.
+	 *
+	 * Ejemplo de uso:
+	 * @code
+	 * void* _checksum(t_page* page) {
+	 *     return (void*) (intptr_t) page_checksum(page);
+	 * }
+	 * t_threadpool* pool = threadpool_create(0);
+	 * t_future* future = threadpool_submit(pool, (void*) _checksum, page);
+	 * ...
+	 * int checksum = (intptr_t) threadpool_join(pool, future);
+	 * threadpool_destroy(pool);
+	 * @endcode
+	 */
+	t_threadpool *threadpool_create(int threads);
+
+	/**
+	 * @brief Crea un pool de hilos fijando cada hilo a una CPU, repartidos en
+	 *        orden entre las CPUs en las que el proceso puede correr.
+	 *
+	 * Si no se puede fijar la afinidad de algún hilo, ese hilo corre sin
+	 * fijar en lugar de fallar.
+	 * @see threadpool_create
+	 */
+	t_threadpool *threadpool_create_pinned(int threads);
+
+	/**
+	 * @brief Envía una tarea al pool para que un hilo ejecute
+	 *        `function(argument)`.
+	 * @return El resultado pendiente de la tarea, que debe ser liberado con
+	 *         `threadpool_join()`.
+	 *
+	 * @note Una tarea puede enviar nuevas tareas al mismo pool y esperarlas:
+	 *       mientras espera, el hilo ejecuta otras tareas pendientes.
+	 */
+	t_future *threadpool_submit(t_threadpool *, void *(*function)(void*), void *argument);
+
+	/**
+	 * @brief Espera a que termine la tarea y libera su resultado pendiente.
+	 * @return El valor retornado por la tarea.
+	 */
+	void *threadpool_join(t_threadpool *, t_future *future);
+
+	/**
+	 * @brief Retorna true si la tarea ya terminó, por lo que
+	 *        `threadpool_join()` no va a esperar.
+	 */
+	bool threadpool_future_is_done(t_future *future);
+
+	/**
+	 * @brief Retorna la cantidad de hilos del pool
+	 */
+	int threadpool_size(t_threadpool *);
+
+	/**
+	 * @brief Espera a que se ejecuten las tareas pendientes y destruye el
+	 *        pool junto con sus hilos.
+	 * @warning Las tareas enviadas deben haber sido esperadas con
+	 *          `threadpool_join()`, o sus resultados pendientes no se liberan.
+	 */
+	void threadpool_destroy(t_threadpool *);
+
+#endif /* THREADPOOL_H_ */
@@ -0,0 +1,227 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include "timer_wheel.h"
+
+#define TIMER_WHEEL_SLOT_MASK (TIMER_WHEEL_SLOTS - 1)
+#define TIMER_WHEEL_MAX_DELAY ((INT64_C(1) << (TIMER_WHEEL_LEVELS * TIMER_WHEEL_SLOT_BITS)) - 1)
+#define TIMER_WHEEL_TIMERS_PER_SLAB 1024
+
+static void timer_wheel_insert(t_timer_wheel *self, t_timer *timer);
+static void timer_wheel_unlink(t_timer_wheel *self, t_timer *timer);
+static bool timer_wheel_skip_empty_ticks(t_timer_wheel *self, int64_t elapsed_ms);
+static void timer_wheel_cascade(t_timer_wheel *self, int level, int slot);
+static void timer_link_init(t_timer_link *head);
+static bool timer_link_is_empty(t_timer_link *head);
+static void timer_link_add(t_timer_link *head, t_timer_link *link);
+static void timer_link_remove(t_timer_link *link);
+static void timer_link_move(t_timer_link *from, t_timer_link *to);
+
+t_timer_wheel *timer_wheel_create(void) {
+	t_timer_wheel *self = malloc(sizeof(t_timer_wheel));
+	for (int level = 0; level < TIMER_WHEEL_LEVELS; level++) {
+		for (int slot = 0; slot < TIMER_WHEEL_SLOTS; slot++) {
+			timer_link_init(&self->slots[level][slot]);
+		}
+		self->level_counts[level] = 0;
+	}
+	timer_link_init(&self->expiring);
+	self->current_tick = 1;
+	self->timers_count = 0;
+	self->clock = temporal_create();
+	self->timers = node_pool_create(sizeof(t_timer), TIMER_WHEEL_TIMERS_PER_SLAB);
+	return self;
+}
+
+t_timer *timer_wheel_schedule(t_timer_wheel *self, int64_t delay_ms, void (*callback)(void*), void *data) {
+	t_timer *timer = node_pool_alloc(self->timers);
+	timer->expiration_ms = self->current_tick - 1 + (delay_ms > 0 ? delay_ms : 1);
+	timer->callback = callback;
+	timer->data = data;
+	timer_wheel_insert(self, timer);
+	self->timers_count++;
+	return timer;
+}
+
+void timer_wheel_cancel(t_timer_wheel *self, t_timer *timer) {
+	timer_wheel_unlink(self, timer);
+	node_pool_free(self->timers, timer);
+	self->timers_count--;
+}
+
+int timer_wheel_advance(t_timer_wheel *self) {
+	return timer_wheel_advance_to(self, temporal_gettime(self->clock));
+}
+
+int timer_wheel_advance_to(t_timer_wheel *self, int64_t elapsed_ms) {
+	int expired = 0;
+
+	while (self->current_tick <= elapsed_ms) {
+		if (!timer_wheel_skip_empty_ticks(self, elapsed_ms)) {
+			break;
+		}
+
+		int64_t tick = self->current_tick;
+		int slot = tick & TIMER_WHEEL_SLOT_MASK;
+		for (int level = 1; slot == 0 && level < TIMER_WHEEL_LEVELS; level++) {
+			slot = (tick >> (level * TIMER_WHEEL_SLOT_BITS)) & TIMER_WHEEL_SLOT_MASK;
+			timer_wheel_cascade(self, level, slot);
+		}
+
+		// Los timers que se programen desde los callbacks se calculan desde
+		// el próximo tick, para no caer en el casillero que se está vaciando
+		timer_link_move(&self->slots[0][tick & TIMER_WHEEL_SLOT_MASK], &self->expiring);
+		self->current_tick = tick + 1;
+
+		while (!timer_link_is_empty(&self->expiring)) {
+			t_timer *timer = (t_timer*) self->expiring.next;
+			void (*callback)(void*) = timer->callback;
+			void *data = timer->data;
+			timer_wheel_cancel(self, timer);
+			callback(data);
+			expired++;
+		}
+	}
+
+	return expired;
+}
+
+int64_t timer_wheel_get_time(t_timer_wheel *self) {
+	return self->current_tick - 1;
+}
+
+int timer_wheel_size(t_timer_wheel *self) {
+	return self->timers_count;
+}
+
+void timer_wheel_destroy(t_timer_wheel *self) {
+	node_pool_destroy(self->timers);
+	temporal_destroy(self->clock);
+	free(self);
+}
+
+void timer_wheel_destroy_and_destroy_elements(t_timer_wheel *self, void(*data_destroyer)(void*)) {
+	for (int level = 0; level < TIMER_WHEEL_LEVELS; level++) {
+		for (int slot = 0; slot < TIMER_WHEEL_SLOTS; slot++) {
+			t_timer_link *head = &self->slots[level][slot];
+			for (t_timer_link *link = head->next; link != head; link = link->next) {
+				data_destroyer(((t_timer*) link)->data);
+			}
+		}
+	}
+	timer_wheel_destroy(self);
+}
+
+/********* PRIVATE FUNCTIONS **************/
+
+static void timer_wheel_insert(t_timer_wheel *self, t_timer *timer) {
+	int64_t expiration = timer->expiration_ms;
+	if (expiration < self->current_tick) {
+		expiration = self->current_tick;
+	}
+
+	// Los timers más lejanos que lo que cubre la rueda se ubican en el último
+	// casillero alcanzable y se vuelven a ubicar cuando llega su turno
+	int64_t delay = expiration - self->current_tick;
+	if (delay > TIMER_WHEEL_MAX_DELAY) {
+		delay = TIMER_WHEEL_MAX_DELAY;
+		expiration = self->current_tick + delay;
+	}
+
+	int level = 0;
+	while (delay >> ((level + 1) * TIMER_WHEEL_SLOT_BITS) != 0) {
+		level++;
+	}
+	int slot = (expiration >> (level * TIMER_WHEEL_SLOT_BITS)) & TIMER_WHEEL_SLOT_MASK;
+	timer_link_add(&self->slots[level][slot], &timer->link);
+	timer->level = level;
+	self->level_counts[level]++;
+}
+
+static void timer_wheel_unlink(t_timer_wheel *self, t_timer *timer) {
+	timer_link_remove(&timer->link);
+	self->level_counts[timer->level]--;
+}
+
+static bool timer_wheel_skip_empty_ticks(t_timer_wheel *self, int64_t elapsed_ms) {
+	// Si los niveles inferiores están vacíos, nada puede expirar antes de que
+	// el primer nivel con timers se redistribuya, por lo que se salta hasta
+	// ese tick. Retorna false si no queda nada por expirar hasta elapsed_ms.
+	int level = 0;
+	while (level < TIMER_WHEEL_LEVELS && self->level_counts[level] == 0) {
+		level++;
+	}
+	if (level == TIMER_WHEEL_LEVELS) {
+		self->current_tick = elapsed_ms + 1;
+		return false;
+	}
+
+	int shift = level * TIMER_WHEEL_SLOT_BITS;
+	int64_t next_cascade = ((self->current_tick + (INT64_C(1) << shift) - 1) >> shift) << shift;
+	if (next_cascade > elapsed_ms) {
+		self->current_tick = elapsed_ms + 1;
+		return false;
+	}
+	self->current_tick = next_cascade;
+	return true;
+}
+
+static void timer_wheel_cascade(t_timer_wheel *self, int level, int slot) {
+	t_timer_link pending;
+	timer_link_init(&pending);
+	timer_link_move(&self->slots[level][slot], &pending);
+
+	while (!timer_link_is_empty(&pending)) {
+		t_timer *timer = (t_timer*) pending.next;
+		timer_wheel_unlink(self, timer);
+		timer_wheel_insert(self, timer);
+	}
+}
+
+static void timer_link_init(t_timer_link *head) {
+	head->previous = head;
+	head->next = head;
+}
+
+static bool timer_link_is_empty(t_timer_link *head) {
+	return head->next == head;
+}
+
+static void timer_link_add(t_timer_link *head, t_timer_link *link) {
+	link->previous = head->previous;
+	link->next = head;
+	head->previous->next = link;
+	head->previous = link;
+}
+
+static void timer_link_remove(t_timer_link *link) {
+	link->previous->next = link->next;
+	link->next->previous = link->previous;
+}
+
+static void timer_link_move(t_timer_link *from, t_timer_link *to) {
+	// Agrega todos los timers de `from` al final de `to`, dejando `from` vacía
+	if (timer_link_is_empty(from)) {
+		return;
+	}
+	from->next->previous = to->previous;
+	from->previous->next = to;
+	to->previous->next = from->next;
+	to->previous = from->previous;
+	timer_link_init(from);
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TIMER_WHEEL_H_
+#define TIMER_WHEEL_H_
+
+	#define TIMER_WHEEL_LEVELS 4
+	#define TIMER_WHEEL_SLOT_BITS 8
+	#define TIMER_WHEEL_SLOTS (1 << TIMER_WHEEL_SLOT_BITS)
+
+	#include <stdint.h>
+	#include "temporal.h"
+	#include "collections/node_pool.h"
+
+	/**
+	 * @file
+	 * @brief `#include <commons/timer_wheel.h>`
+	 *
+	 * Rueda de timers jerárquica con resolución de 1 milisegundo. Cada nivel
+	 * tiene TIMER_WHEEL_SLOTS casilleros: el primero cubre los próximos 256 ms
+	 * de a 1 ms, el segundo los próximos 65 s de a 256 ms, y así. Al dar una
+	 * vuelta completa un nivel, los timers del casillero que toca en el nivel
+	 * superior se redistribuyen en los inferiores, por lo que programar,
+	 * cancelar y expirar un timer cuesta O(1) amortizado sin importar cuántos
+	 * haya pendientes.
+	 *
+	 * @warning La rueda no utiliza semáforos, por lo que debe ser usada por un
+	 *          único hilo (por ejemplo, el del planificador).
+	 */
+
+	/** @cond INCLUDE_INTERNALS */
+	typedef struct t_timer_link {
+		struct t_timer_link *previous;
+		struct t_timer_link *next;
+	} t_timer_link;
+	/** @endcond */
+
+	/**
+	 * @struct t_timer
+	 * @brief Timer pendiente. Se obtiene con `timer_wheel_schedule()` y sólo
+	 *        es válido hasta que expira o es cancelado.
+	 */
+	typedef struct {
+		t_timer_link link;
+		int level;
+		int64_t expiration_ms;
+		void (*callback)(void*);
+		void *data;
+	} t_timer;
+
+	/**
+	 * @struct t_timer_wheel
+	 * @brief Rueda de timers. Inicializar con `timer_wheel_create()`
+	 */
+	typedef struct {
+		t_timer_link slots[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS];
+		t_timer_link expiring;
+		int64_t current_tick;
+		int timers_count;
+		int level_counts[TIMER_WHEEL_LEVELS];
+		t_temporal *clock;
+		t_node_pool *timers;
+	} t_timer_wheel;
+
+	/**
+	 * @brief Crea una rueda de timers e inicia su reloj.
+	 * @return Retorna un puntero a la rueda creada, liberable con:
+	 *         - `timer_wheel_destroy()` si se quiere liberar la rueda
+	 *           descartando los timers pendientes.
+	 *         - `timer_wheel_destroy_and_destroy_elements()` si además se
+	 *           quieren liberar los datos de los timers pendientes.
+	 *
+	 * Ejemplo de uso:
+	 * @code
+	 * void _wake_up(t_pcb* pcb) {
+	 *     list_add(ready, pcb);
+	 * }
+	 * t_timer_wheel* sleeping = timer_wheel_create();
+	 * pcb->sleep_timer = timer_wheel_schedule(sleeping, 1500, (void*) _wake_up, pcb);
+	 * ...
+	 * // En cada vuelta del planificador
+	 * timer_wheel_advance(sleeping);
+	 * @endcode
+	 */
+	t_timer_wheel *timer_wheel_create(void);
+
+	/**
+	 * @brief Programa un timer que ejecuta `callback(data)` dentro de
+	 *        `delay_ms` milisegundos, contados desde el último avance de la
+	 *        rueda.
+	 * @return El timer programado, que puede ser cancelado con
+	 *         `timer_wheel_cancel()` mientras no haya expirado.
+	 *
+	 * @note Un `delay_ms` menor a 1 hace que el timer expire en el próximo
+	 *       avance de la rueda.
+	 */
+	t_timer *timer_wheel_schedule(t_timer_wheel *, int64_t delay_ms, void (*callback)(void*), void *data);
+
+	/**
+	 * @brief Cancela un timer pendiente sin ejecutar su callback.
+	 * @warning El timer no debe haber expirado ni haber sido cancelado antes,
+	 *          ya que en ese caso su memoria pudo haber sido reutilizada.
+	 */
+	void timer_wheel_cancel(t_timer_wheel *, t_timer *timer);
+
+	/**
+	 * @brief Avanza la rueda hasta el tiempo transcurrido según su reloj,
+	 *        ejecutando en orden los callbacks de los timers que expiraron.
+	 * @return La cantidad de timers que expiraron.
+	 *
+	 * @note Los callbacks pueden programar y cancelar timers, pero no deben
+	 *       avanzar ni destruir la rueda.
+	 */
+	int timer_wheel_advance(t_timer_wheel *);
+
+	/**
+	 * @brief Avanza la rueda hasta `elapsed_ms` milisegundos desde su
+	 *        creación, sin consultar su reloj.
+	 * @see timer_wheel_advance
+	 */
+	int timer_wheel_advance_to(t_timer_wheel *, int64_t elapsed_ms);
+
+	/**
+	 * @brief Retorna hasta qué milisegundo, contado desde su creación, fue
+	 *        avanzada la rueda.
+	 */
+	int64_t timer_wheel_get_time(t_timer_wheel *);
+
+	/**
+	 * @brief Retorna la cantidad de timers pendientes
+	 */
+	int timer_wheel_size(t_timer_wheel *);
+
+	/**
+	 * @brief Destruye la rueda descartando los timers pendientes sin ejecutar
+	 *        sus callbacks.
+	 */
+	void timer_wheel_destroy(t_timer_wheel *);
+
+	/**
+	 * @brief Destruye la rueda, liberando con `data_destroyer` los datos de
+	 *        los timers pendientes.
+	 */
+	void timer_wheel_destroy_and_destroy_elements(t_timer_wheel *, void(*data_destroyer)(void*));
+
+#endif /* TIMER_WHEEL_H_ */
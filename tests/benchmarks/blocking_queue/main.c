@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <time.h>
+#include <commons/collections/blocking_queue.h>
+
+#define MESSAGES 1000000
+
+static int64_t now_ns() {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (int64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+typedef struct {
+	t_blocking_queue *queue;
+	int messages;
+} t_producer_args;
+
+static void *produce(void *args) {
+	t_producer_args *producer = args;
+	for (intptr_t i = 1; i <= producer->messages; i++) {
+		blocking_queue_push(producer->queue, (void*) i);
+	}
+	return NULL;
+}
+
+static void *consume(void *queue) {
+	void *element;
+	while (blocking_queue_pop(queue, &element));
+	return NULL;
+}
+
+static void measure_topology(int producers, int consumers, int max_size) {
+	t_blocking_queue *queue = blocking_queue_create(max_size);
+	pthread_t producer_threads[producers], consumer_threads[consumers];
+	t_producer_args args = { .queue = queue, .messages = MESSAGES / producers };
+
+	int64_t start = now_ns();
+	for (int i = 0; i < consumers; i++) pthread_create(&consumer_threads[i], NULL, consume, queue);
+	for (int i = 0; i < producers; i++) pthread_create(&producer_threads[i], NULL, produce, &args);
+	for (int i = 0; i < producers; i++) pthread_join(producer_threads[i], NULL);
+	blocking_queue_close(queue);
+	for (int i = 0; i < consumers; i++) pthread_join(consumer_threads[i], NULL);
+	int64_t elapsed = now_ns() - start;
+
+	int messages = args.messages * producers;
+	printf("  %2d -> %-2d (capacidad %4d): %8.0f mensajes/ms\n",
+		producers, consumers, max_size, (double) messages * 1000000 / elapsed);
+	blocking_queue_destroy(queue);
+}
+
+void bench_blocking_queue_topologies() {
+	/**
+	* @brief Mensajes por milisegundo entre productores y consumidores a
+	*        través de una única cola bloqueante.
+	*/
+	int topologies[][2] = { {1, 1}, {1, 4}, {4, 1}, {4, 4}, {16, 16} };
+
+	printf("bench_blocking_queue_topologies (%d mensajes):\n", MESSAGES);
+	for (int i = 0; i < sizeof(topologies) / sizeof(topologies[0]); i++) {
+		for (int max_size = 16; max_size <= 1024; max_size *= 64) {
+			measure_topology(topologies[i][0], topologies[i][1], max_size);
+		}
+	}
+	printf("\n");
+}
+
+int main(int argc, char** argv) {
+	bench_blocking_queue_topologies();
+
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,388 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <commons/string.h>
+#include <commons/collections/dictionary.h>
+
+static int64_t now_ns() {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (int64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+/*
+ * Implementación con listas encadenadas que utilizaba t_dictionary antes del
+ * direccionamiento abierto, incluida sólo para comparar.
+ */
+
+typedef struct chained_element {
+	char *key;
+	unsigned int hashcode;
+	void *data;
+	struct chained_element *next;
+} t_chained_element;
+
+typedef struct {
+	t_chained_element **elements;
+	int table_max_size;
+	int table_current_size;
+	int elements_amount;
+} t_chained_dictionary;
+
+static unsigned int chained_hash(char *key, int key_len) {
+	unsigned int hash = 0;
+	for (int index = 0; index < key_len; index++) {
+		hash += (unsigned char) key[index];
+		hash += (hash << 10);
+		hash ^= (hash >> 6);
+	}
+	hash += (hash << 3);
+	hash ^= (hash >> 11);
+	hash += (hash << 15);
+	return hash;
+}
+
+static t_chained_dictionary *chained_create() {
+	t_chained_dictionary *self = malloc(sizeof(t_chained_dictionary));
+	self->table_max_size = DEFAULT_DICTIONARY_INITIAL_SIZE;
+	self->elements = calloc(self->table_max_size, sizeof(t_chained_element*));
+	self->table_current_size = 0;
+	self->elements_amount = 0;
+	return self;
+}
+
+static t_chained_element *chained_get_element(t_chained_dictionary *self, char *key) {
+	unsigned int key_hash = chained_hash(key, strlen(key));
+	t_chained_element *element = self->elements[key_hash % self->table_max_size];
+	while (element != NULL && element->hashcode != key_hash) {
+		element = element->next;
+	}
+	return element;
+}
+
+static void chained_resize(t_chained_dictionary *self, int new_max_size) {
+	t_chained_element **new_table = calloc(new_max_size, sizeof(t_chained_element*));
+	self->table_current_size = 0;
+	for (int table_index = 0; table_index < self->table_max_size; table_index++) {
+		t_chained_element *old_element = self->elements[table_index];
+		while (old_element != NULL) {
+			t_chained_element *next_element = old_element->next;
+			t_chained_element **indirect = &new_table[old_element->hashcode % new_max_size];
+			if (*indirect == NULL) {
+				self->table_current_size++;
+			}
+			while (*indirect != NULL) {
+				indirect = &(*indirect)->next;
+			}
+			*indirect = old_element;
+			old_element->next = NULL;
+			old_element = next_element;
+		}
+	}
+	free(self->elements);
+	self->elements = new_table;
+	self->table_max_size = new_max_size;
+}
+
+static void chained_put(t_chained_dictionary *self, char *key, void *data) {
+	t_chained_element *existing_element = chained_get_element(self, key);
+	if (existing_element != NULL) {
+		existing_element->data = data;
+		return;
+	}
+
+	unsigned int key_hash = chained_hash(key, strlen(key));
+	t_chained_element *new_element = malloc(sizeof(t_chained_element));
+	*new_element = (t_chained_element) { .key = strdup(key), .hashcode = key_hash, .data = data, .next = NULL };
+
+	t_chained_element **indirect = &self->elements[key_hash % self->table_max_size];
+	if (*indirect == NULL) {
+		*indirect = new_element;
+		if (++self->table_current_size >= self->table_max_size) {
+			chained_resize(self, self->table_max_size * 2);
+		}
+	} else {
+		while (*indirect != NULL) {
+			indirect = &(*indirect)->next;
+		}
+		*indirect = new_element;
+	}
+	self->elements_amount++;
+}
+
+static void *chained_get(t_chained_dictionary *self, char *key) {
+	t_chained_element *element = chained_get_element(self, key);
+	return element != NULL ? element->data : NULL;
+}
+
+static void *chained_remove(t_chained_dictionary *self, char *key) {
+	unsigned int key_hash = chained_hash(key, strlen(key));
+	int index = key_hash % self->table_max_size;
+	t_chained_element **indirect = &self->elements[index];
+	while (*indirect != NULL && (*indirect)->hashcode != key_hash) {
+		indirect = &(*indirect)->next;
+	}
+	if (*indirect == NULL) {
+		return NULL;
+	}
+	t_chained_element *element = *indirect;
+	void *data = element->data;
+	*indirect = element->next;
+	if (self->elements[index] == NULL) {
+		self->table_current_size--;
+	}
+	free(element->key);
+	free(element);
+	self->elements_amount--;
+	return data;
+}
+
+static void chained_destroy(t_chained_dictionary *self) {
+	for (int table_index = 0; table_index < self->table_max_size; table_index++) {
+		while (self->elements[table_index] != NULL) {
+			chained_remove(self, self->elements[table_index]->key);
+		}
+	}
+	free(self->elements);
+	free(self);
+}
+
+/********* BENCHMARKS **************/
+
+static char **create_keys(int size) {
+	char **keys = malloc(size * sizeof(char*));
+	for (int i = 0; i < size; i++) {
+		keys[i] = string_from_format("file-%d.txt", i);
+	}
+	return keys;
+}
+
+static void destroy_keys(char **keys, int size) {
+	for (int i = 0; i < size; i++) {
+		free(keys[i]);
+	}
+	free(keys);
+}
+
+void bench_dictionary_operations() {
+	/**
+	* @brief Compara put, get y remove entre la tabla encadenada anterior y el
+	*        direccionamiento abierto actual.
+	*/
+	printf("bench_dictionary_operations (ns/op):\n");
+	for (int size = 1000; size <= 1000000; size *= 10) {
+		char **keys = create_keys(size);
+		int64_t start;
+
+		t_chained_dictionary *chained = chained_create();
+		start = now_ns();
+		for (int i = 0; i < size; i++) chained_put(chained, keys[i], keys[i]);
+		double chained_put_ns = (double) (now_ns() - start) / size;
+		start = now_ns();
+		for (int i = 0; i < size; i++) chained_get(chained, keys[i]);
+		double chained_get_ns = (double) (now_ns() - start) / size;
+		start = now_ns();
+		for (int i = 0; i < size; i++) chained_remove(chained, keys[i]);
+		double chained_remove_ns = (double) (now_ns() - start) / size;
+		chained_destroy(chained);
+
+		t_dictionary *dictionary = dictionary_create();
+		start = now_ns();
+		for (int i = 0; i < size; i++) dictionary_put(dictionary, keys[i], keys[i]);
+		double put_ns = (double) (now_ns() - start) / size;
+		start = now_ns();
+		for (int i = 0; i < size; i++) dictionary_get(dictionary, keys[i]);
+		double get_ns = (double) (now_ns() - start) / size;
+		start = now_ns();
+		for (int i = 0; i < size; i++) dictionary_remove(dictionary, keys[i]);
+		double remove_ns = (double) (now_ns() - start) / size;
+		dictionary_destroy(dictionary);
+
+		printf("  %7d claves: put %7.1f -> %6.1f, get %7.1f -> %6.1f, remove %7.1f -> %6.1f\n",
+			size, chained_put_ns, put_ns, chained_get_ns, get_ns, chained_remove_ns, remove_ns);
+		destroy_keys(keys, size);
+	}
+	printf("\n");
+}
+
+static int compare_latencies(const void* a, const void* b) {
+	int64_t first = *(int64_t*) a, second = *(int64_t*) b;
+	return (first > second) - (first < second);
+}
+
+static void measure_put_latency(char* mode, char** keys, int size, bool incremental) {
+	int64_t* latencies = malloc(size * sizeof(int64_t));
+	t_dictionary* dictionary = dictionary_create();
+	dictionary_set_incremental_resize(dictionary, incremental);
+
+	for (int i = 0; i < size; i++) {
+		int64_t start = now_ns();
+		dictionary_put(dictionary, keys[i], keys[i]);
+		latencies[i] = now_ns() - start;
+	}
+
+	qsort(latencies, size, sizeof(int64_t), compare_latencies);
+	printf("  %-11s: p50 %6ld ns, p99 %6ld ns, p999 %7ld ns, max %9ld ns\n", mode,
+		latencies[size / 2], latencies[size * 99 / 100], latencies[size * 999 / 1000], latencies[size - 1]);
+
+	dictionary_destroy(dictionary);
+	free(latencies);
+}
+
+void bench_dictionary_put_latency() {
+	/**
+	* @brief Latencia de cada dictionary_put() al cargar 2M claves, con y sin
+	*        redimensionamiento incremental.
+	*/
+	int size = 2000000;
+	char **keys = create_keys(size);
+
+	printf("bench_dictionary_put_latency (%d claves):\n", size);
+	measure_put_latency("completo", keys, size, false);
+	measure_put_latency("incremental", keys, size, true);
+	printf("\n");
+
+	destroy_keys(keys, size);
+}
+
+void bench_dictionary_bulk_load() {
+	/**
+	* @brief Carga masiva de claves conocidas de antemano, dejando crecer la
+	*        tabla o creándola con la capacidad final.
+	*/
+	printf("bench_dictionary_bulk_load (ns/put):\n");
+	for (int size = 1000; size <= 1000000; size *= 10) {
+		char **keys = create_keys(size);
+		int64_t start;
+
+		t_dictionary *growing = dictionary_create();
+		start = now_ns();
+		for (int i = 0; i < size; i++) dictionary_put(growing, keys[i], keys[i]);
+		double growing_ns = (double) (now_ns() - start) / size;
+		dictionary_destroy(growing);
+
+		start = now_ns();
+		t_dictionary *presized = dictionary_create_with_capacity(size);
+		for (int i = 0; i < size; i++) dictionary_put(presized, keys[i], keys[i]);
+		double presized_ns = (double) (now_ns() - start) / size;
+		dictionary_destroy(presized);
+
+		printf("  %7d claves: dictionary_create %6.1f, dictionary_create_with_capacity %6.1f\n",
+			size, growing_ns, presized_ns);
+		destroy_keys(keys, size);
+	}
+	printf("\n");
+}
+
+static char **create_keys_of_length(int size, int length) {
+	char **keys = malloc(size * sizeof(char*));
+	for (int i = 0; i < size; i++) {
+		keys[i] = string_repeat('k', length);
+		char *suffix = string_from_format("%d", i);
+		memcpy(keys[i] + length - strlen(suffix), suffix, strlen(suffix));
+		free(suffix);
+	}
+	return keys;
+}
+
+void bench_dictionary_hash_by_key_length() {
+	/**
+	* @brief Costo del hash según el largo de la clave: Jenkins one-at-a-time
+	*        por sí solo, y búsquedas en la tabla encadenada anterior contra el
+	*        diccionario actual con hash de a palabras y semilla.
+	*/
+	int size = 1024, lookups = 1000000;
+	volatile unsigned int sink = 0;
+
+	printf("bench_dictionary_hash_by_key_length (ns/op):\n");
+	for (int length = 4; length <= 256; length *= 2) {
+		char **keys = create_keys_of_length(size, length);
+		t_chained_dictionary *chained = chained_create();
+		t_dictionary *dictionary = dictionary_create();
+		for (int i = 0; i < size; i++) {
+			chained_put(chained, keys[i], keys[i]);
+			dictionary_put(dictionary, keys[i], keys[i]);
+		}
+
+		int64_t start = now_ns();
+		for (int i = 0; i < lookups; i++) sink += chained_hash(keys[i % size], length);
+		double jenkins_ns = (double) (now_ns() - start) / lookups;
+		start = now_ns();
+		for (int i = 0; i < lookups; i++) chained_get(chained, keys[i % size]);
+		double chained_get_ns = (double) (now_ns() - start) / lookups;
+		start = now_ns();
+		for (int i = 0; i < lookups; i++) dictionary_get(dictionary, keys[i % size]);
+		double get_ns = (double) (now_ns() - start) / lookups;
+
+		printf("  %3d bytes: jenkins hash %6.1f (%5.2f GB/s), get %6.1f -> %6.1f\n",
+			length, jenkins_ns, length / jenkins_ns, chained_get_ns, get_ns);
+
+		chained_destroy(chained);
+		dictionary_destroy(dictionary);
+		destroy_keys(keys, size);
+	}
+	printf("\n");
+}
+
+void bench_dictionary_counters() {
+	/**
+	* @brief Contar apariciones de claves repetidas: dictionary_get() seguido
+	*        de dictionary_put() contra una sola búsqueda con
+	*        dictionary_get_or_insert().
+	*/
+	int size = 1000000, distinct = 10000;
+	char **keys = create_keys(distinct);
+
+	t_dictionary *get_and_put = dictionary_create();
+	int64_t start = now_ns();
+	for (int i = 0; i < size; i++) {
+		char *key = keys[i % distinct];
+		intptr_t count = (intptr_t) dictionary_get(get_and_put, key);
+		dictionary_put(get_and_put, key, (void*) (count + 1));
+	}
+	double get_and_put_ns = (double) (now_ns() - start) / size;
+	dictionary_destroy(get_and_put);
+
+	t_dictionary *upsert = dictionary_create();
+	start = now_ns();
+	for (int i = 0; i < size; i++) {
+		void **count = dictionary_get_or_insert(upsert, keys[i % distinct], NULL);
+		*count = (void*) ((intptr_t) *count + 1);
+	}
+	double upsert_ns = (double) (now_ns() - start) / size;
+	dictionary_destroy(upsert);
+
+	printf("bench_dictionary_counters (ns/incremento):\n");
+	printf("  get + put %6.1f, get_or_insert %6.1f\n\n", get_and_put_ns, upsert_ns);
+	destroy_keys(keys, distinct);
+}
+
+int main(int argc, char** argv) {
+	bench_dictionary_operations();
+	bench_dictionary_put_latency();
+	bench_dictionary_bulk_load();
+	bench_dictionary_hash_by_key_length();
+	bench_dictionary_counters();
+
+	return (EXIT_SUCCESS);
+}
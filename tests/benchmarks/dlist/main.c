@@ -0,0 +1,120 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <commons/collections/list.h>
+#include <commons/collections/dlist.h>
+
+#define FRAMES 10000
+
+typedef struct {
+	int number;
+	t_double_link_element *lru_node;
+} t_page;
+
+static int64_t now_ns() {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (int64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+void bench_dlist_lru() {
+	/**
+	* @brief Reemplazo LRU con FRAMES marcos: cada referencia mueve la página
+	*        al principio y cada reemplazo quita la del final y agrega la
+	*        nueva, con t_list (buscando la página) y con t_dlist (usando el
+	*        nodo guardado en la página).
+	*/
+	t_page *pages = malloc(FRAMES * sizeof(t_page));
+	for (int i = 0; i < FRAMES; i++) pages[i].number = i;
+
+	printf("bench_dlist_lru (%d marcos, ns/operación):\n", FRAMES);
+
+	int operations = 20000;
+	t_list *list = list_create();
+	for (int i = 0; i < FRAMES; i++) list_add(list, &pages[i]);
+	srand(1);
+	int64_t start = now_ns();
+	for (int i = 0; i < operations; i++) {
+		t_page *page = &pages[rand() % FRAMES];
+		if (i % 10 == 0) {
+			page = list_remove(list, list_size(list) - 1);
+		} else {
+			list_remove_element(list, page);
+		}
+		list_add_in_index(list, 0, page);
+	}
+	double list_ns = (double) (now_ns() - start) / operations;
+	list_destroy(list);
+
+	operations = 10000000;
+	t_dlist *dlist = dlist_create();
+	for (int i = 0; i < FRAMES; i++) pages[i].lru_node = dlist_add_last(dlist, &pages[i]);
+	srand(1);
+	start = now_ns();
+	for (int i = 0; i < operations; i++) {
+		t_page *page = &pages[rand() % FRAMES];
+		if (i % 10 == 0) {
+			page = dlist_remove_last(dlist);
+			page->lru_node = dlist_add_first(dlist, page);
+		} else {
+			dlist_move_to_first(dlist, page->lru_node);
+		}
+	}
+	double dlist_ns = (double) (now_ns() - start) / operations;
+	dlist_destroy(dlist);
+
+	printf("  t_list  %10.1f\n", list_ns);
+	printf("  t_dlist %10.1f\n", dlist_ns);
+	free(pages);
+	printf("\n");
+}
+
+void bench_dlist_remove_last() {
+	/**
+	* @brief Vaciar una cola de FRAMES elementos quitando siempre el último.
+	*/
+	printf("bench_dlist_remove_last (%d elementos, ns/elemento):\n", FRAMES);
+
+	t_list *list = list_create();
+	for (intptr_t i = 0; i < FRAMES; i++) list_add(list, (void*) i);
+	int64_t start = now_ns();
+	while (!list_is_empty(list)) list_remove(list, list_size(list) - 1);
+	double list_ns = (double) (now_ns() - start) / FRAMES;
+	list_destroy(list);
+
+	t_dlist *dlist = dlist_create();
+	for (intptr_t i = 0; i < FRAMES; i++) dlist_add_last(dlist, (void*) i);
+	start = now_ns();
+	while (!dlist_is_empty(dlist)) dlist_remove_last(dlist);
+	double dlist_ns = (double) (now_ns() - start) / FRAMES;
+	dlist_destroy(dlist);
+
+	printf("  t_list  %10.1f\n", list_ns);
+	printf("  t_dlist %10.1f\n", dlist_ns);
+	printf("\n");
+}
+
+int main(int argc, char** argv) {
+	bench_dlist_lru();
+	bench_dlist_remove_last();
+
+	return (EXIT_SUCCESS);
+}
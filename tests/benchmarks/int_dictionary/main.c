@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <commons/string.h>
+#include <commons/collections/dictionary.h>
+#include <commons/collections/int_dictionary.h>
+
+static int64_t now_ns() {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (int64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+void bench_int_dictionary_operations() {
+	/**
+	* @brief Compara put, get y remove con claves numéricas entre t_dictionary
+	*        usando string_itoa() y t_int_dictionary.
+	*/
+	printf("bench_int_dictionary_operations (ns/op):\n");
+	for (int size = 1000; size <= 1000000; size *= 10) {
+		int64_t start;
+
+		t_dictionary *dictionary = dictionary_create();
+		start = now_ns();
+		for (int pid = 0; pid < size; pid++) {
+			char *key = string_itoa(pid);
+			dictionary_put(dictionary, key, NULL);
+			free(key);
+		}
+		double put_ns = (double) (now_ns() - start) / size;
+		start = now_ns();
+		for (int pid = 0; pid < size; pid++) {
+			char *key = string_itoa(pid);
+			dictionary_get(dictionary, key);
+			free(key);
+		}
+		double get_ns = (double) (now_ns() - start) / size;
+		start = now_ns();
+		for (int pid = 0; pid < size; pid++) {
+			char *key = string_itoa(pid);
+			dictionary_remove(dictionary, key);
+			free(key);
+		}
+		double remove_ns = (double) (now_ns() - start) / size;
+		dictionary_destroy(dictionary);
+
+		t_int_dictionary *int_dictionary = int_dictionary_create();
+		start = now_ns();
+		for (int pid = 0; pid < size; pid++) int_dictionary_put(int_dictionary, pid, NULL);
+		double int_put_ns = (double) (now_ns() - start) / size;
+		start = now_ns();
+		for (int pid = 0; pid < size; pid++) int_dictionary_get(int_dictionary, pid);
+		double int_get_ns = (double) (now_ns() - start) / size;
+		start = now_ns();
+		for (int pid = 0; pid < size; pid++) int_dictionary_remove(int_dictionary, pid);
+		double int_remove_ns = (double) (now_ns() - start) / size;
+		int_dictionary_destroy(int_dictionary);
+
+		printf("  %7d claves: put %6.1f -> %5.1f, get %6.1f -> %5.1f, remove %6.1f -> %5.1f\n",
+			size, put_ns, int_put_ns, get_ns, int_get_ns, remove_ns, int_remove_ns);
+	}
+	printf("\n");
+}
+
+int main(int argc, char** argv) {
+	bench_int_dictionary_operations();
+
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,308 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <commons/collections/list.h>
+#include <commons/collections/queue.h>
+#include <commons/threadpool.h>
+
+static int64_t now_ns() {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (int64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+void bench_list_add() {
+	/**
+	* @brief El costo de agregar al final de la lista no depende de su tamaño.
+	*/
+	printf("bench_list_add:\n");
+	for (int size = 10; size <= 10000000; size *= 10) {
+		t_list* list = list_create();
+
+		int64_t start = now_ns();
+		for (int i = 0; i < size; i++) {
+			list_add(list, (void*) (intptr_t) i);
+		}
+		int64_t elapsed = now_ns() - start;
+
+		printf("  %9d elementos: %8.2f ns/op\n", size, (double) elapsed / size);
+		list_destroy(list);
+	}
+	printf("\n");
+}
+
+void bench_queue_push() {
+	/**
+	* @brief El costo de encolar no depende de la cantidad de elementos en espera.
+	*/
+	printf("bench_queue_push:\n");
+	for (int size = 10; size <= 10000000; size *= 10) {
+		t_queue* queue = queue_create();
+
+		int64_t start = now_ns();
+		for (int i = 0; i < size; i++) {
+			queue_push(queue, (void*) (intptr_t) i);
+		}
+		int64_t elapsed = now_ns() - start;
+
+		printf("  %9d elementos: %8.2f ns/op\n", size, (double) elapsed / size);
+		queue_destroy(queue);
+	}
+	printf("\n");
+}
+
+static bool int_less_or_equal(void* a, void* b) {
+	return (intptr_t) a <= (intptr_t) b;
+}
+
+static t_list* insertion_sorted(t_list* self, bool (*comparator)(void*, void*)) {
+	// Algoritmo que utilizaba list_sort() antes del merge sort
+	t_list* sorted = list_create();
+	void _add_sorted(void* data) {
+		list_add_sorted(sorted, data, comparator);
+	}
+	list_iterate(self, _add_sorted);
+	return sorted;
+}
+
+static t_list* create_numbers(int size, char* order) {
+	t_list* numbers = list_create();
+	srand(size);
+	for (int i = 0; i < size; i++) {
+		intptr_t number = i;
+		if (strcmp(order, "reversed") == 0) {
+			number = size - i;
+		} else if (strcmp(order, "random") == 0) {
+			number = rand();
+		}
+		list_add(numbers, (void*) number);
+	}
+	return numbers;
+}
+
+void bench_list_sort() {
+	/**
+	* @brief Compara el ordenamiento por inserción anterior con el merge sort
+	*        sobre listas ordenadas, invertidas y aleatorias.
+	*/
+	char* orders[] = { "sorted", "reversed", "random" };
+
+	printf("bench_list_sort:\n");
+	for (int size = 1000; size <= 25000; size *= 5) {
+		for (int o = 0; o < 3; o++) {
+			t_list* numbers = create_numbers(size, orders[o]);
+
+			int64_t start = now_ns();
+			t_list* sorted = insertion_sorted(numbers, int_less_or_equal);
+			int64_t insertion = now_ns() - start;
+			list_destroy(sorted);
+
+			start = now_ns();
+			list_sort(numbers, int_less_or_equal);
+			int64_t merge = now_ns() - start;
+
+			printf("  %6d elementos %-8s: insercion %10.3f ms, merge %8.3f ms\n",
+				size, orders[o], insertion / 1e6, merge / 1e6);
+			list_destroy(numbers);
+		}
+	}
+	printf("\n");
+}
+
+static intptr_t page_checksum(intptr_t frame) {
+	// Simula recorrer el contenido del marco
+	uint64_t checksum = frame;
+	for (int i = 0; i < 200; i++) {
+		checksum = checksum * 6364136223846793005u + 1442695040888963407u;
+	}
+	return checksum >> 1;
+}
+
+static void* map_checksum(void* frame) {
+	return (void*) page_checksum((intptr_t) frame);
+}
+
+static bool is_dirty(void* frame) {
+	return page_checksum((intptr_t) frame) % 3 == 0;
+}
+
+static void* max_checksum(void* frame1, void* frame2) {
+	return page_checksum((intptr_t) frame1) >= page_checksum((intptr_t) frame2) ? frame1 : frame2;
+}
+
+void bench_list_parallel() {
+	/**
+	* @brief Map, filter y fold sobre 1M marcos de memoria con una operación
+	*        costosa por elemento, secuencialmente y en pools de 1 a 16 hilos.
+	*/
+	int size = 1000000;
+	t_list* frames = list_create();
+	for (intptr_t i = 0; i < size; i++) list_add(frames, (void*) i);
+
+	printf("bench_list_parallel (ms, %d marcos):\n", size);
+
+	int64_t start = now_ns();
+	t_list* mapped = list_map(frames, map_checksum);
+	double map_ms = (now_ns() - start) / 1e6;
+	list_destroy(mapped);
+	start = now_ns();
+	t_list* filtered = list_filter(frames, is_dirty);
+	double filter_ms = (now_ns() - start) / 1e6;
+	list_destroy(filtered);
+	start = now_ns();
+	list_fold1(frames, max_checksum);
+	double fold_ms = (now_ns() - start) / 1e6;
+	printf("  secuencial: map %8.2f, filter %8.2f, fold %8.2f\n", map_ms, filter_ms, fold_ms);
+
+	for (int threads_count = 1; threads_count <= 16; threads_count *= 2) {
+		t_threadpool* threads = threadpool_create(threads_count);
+
+		start = now_ns();
+		mapped = list_parallel_map(frames, threads, map_checksum);
+		map_ms = (now_ns() - start) / 1e6;
+		list_destroy(mapped);
+		start = now_ns();
+		filtered = list_parallel_filter(frames, threads, is_dirty);
+		filter_ms = (now_ns() - start) / 1e6;
+		list_destroy(filtered);
+		start = now_ns();
+		list_parallel_fold(frames, threads, list_get(frames, 0), max_checksum);
+		fold_ms = (now_ns() - start) / 1e6;
+
+		printf("  %2d hilos:   map %8.2f, filter %8.2f, fold %8.2f\n", threads_count, map_ms, filter_ms, fold_ms);
+		threadpool_destroy(threads);
+	}
+
+	list_destroy(frames);
+	printf("\n");
+}
+
+static intptr_t iterated_sum;
+
+static void add_to_sum(void* number) {
+	iterated_sum += (intptr_t) number;
+}
+
+void bench_list_unrolled() {
+	/**
+	* @brief Compara la lista enlazada con la lista desenrollada al agregar 1M
+	*        elementos al final, recorrerlos e insertar 20k en el medio de una
+	*        lista de 100k.
+	*/
+	printf("bench_list_unrolled (ns/op):\n");
+	for (int unrolled = 0; unrolled <= 1; unrolled++) {
+		int size = 1000000;
+		t_list* list = unrolled ? list_create_unrolled() : list_create();
+
+		int64_t start = now_ns();
+		for (intptr_t i = 0; i < size; i++) {
+			list_add(list, (void*) i);
+		}
+		double add_ns = (double) (now_ns() - start) / size;
+
+		iterated_sum = 0;
+		start = now_ns();
+		list_iterate(list, add_to_sum);
+		double iterate_ns = (double) (now_ns() - start) / size;
+
+		start = now_ns();
+		t_list_iterator* iterator = list_iterator_create(list);
+		while (list_iterator_has_next(iterator)) {
+			iterated_sum += (intptr_t) list_iterator_next(iterator);
+		}
+		list_iterator_destroy(iterator);
+		double iterator_ns = (double) (now_ns() - start) / size;
+		list_destroy(list);
+
+		int inserts = 20000;
+		list = unrolled ? list_create_unrolled() : list_create();
+		for (intptr_t i = 0; i < 100000; i++) {
+			list_add(list, (void*) i);
+		}
+		start = now_ns();
+		for (intptr_t i = 0; i < inserts; i++) {
+			list_add_in_index(list, list_size(list) / 2, (void*) i);
+		}
+		double insert_ns = (double) (now_ns() - start) / inserts;
+		list_destroy(list);
+
+		printf("  %-14s add %6.2f, iterate %6.2f, iterator %6.2f, insertar en el medio %9.2f\n",
+				unrolled ? "desenrollada:" : "enlazada:", add_ns, iterate_ns, iterator_ns, insert_ns);
+	}
+	printf("\n");
+}
+
+void bench_list_get_loop() {
+	/**
+	* @brief Recorre la lista con `list_get(list, i)`. En orden creciente cada
+	*        acceso continúa desde el anterior; en orden decreciente cada uno
+	*        vuelve a empezar desde el principio, como antes del cursor.
+	*/
+	printf("bench_list_get_loop (ns/op):\n");
+	for (int size = 1000; size <= 32000; size *= 2) {
+		for (int unrolled = 0; unrolled <= 1; unrolled++) {
+			t_list* list = unrolled ? list_create_unrolled() : list_create();
+			for (intptr_t i = 0; i < size; i++) {
+				list_add(list, (void*) i);
+			}
+
+			intptr_t sum = 0;
+			int64_t start = now_ns();
+			for (int i = 0; i < list_size(list); i++) {
+				sum += (intptr_t) list_get(list, i);
+			}
+			double forward_ns = (double) (now_ns() - start) / size;
+
+			start = now_ns();
+			for (int i = list_size(list) - 1; i >= 0; i--) {
+				sum += (intptr_t) list_get(list, i);
+			}
+			double backward_ns = (double) (now_ns() - start) / size;
+
+			start = now_ns();
+			for (int i = 0; i < list_size(list); ) {
+				if ((intptr_t) list_get(list, i) % 2 == 0) {
+					list_remove(list, i);
+				} else {
+					i++;
+				}
+			}
+			double remove_ns = (double) (now_ns() - start) / size;
+
+			printf("  %6d elementos, %-14s creciente %8.2f, decreciente %10.2f, get y remove %8.2f\n",
+					size, unrolled ? "desenrollada:" : "enlazada:", forward_ns, backward_ns, remove_ns);
+			list_destroy(list);
+		}
+	}
+	printf("\n");
+}
+
+int main(int argc, char** argv) {
+	bench_list_add();
+	bench_queue_push();
+	bench_list_sort();
+	bench_list_parallel();
+	bench_list_unrolled();
+	bench_list_get_loop();
+
+	return (EXIT_SUCCESS);
+}
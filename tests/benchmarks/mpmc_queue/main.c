@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <time.h>
+#include <commons/collections/queue.h>
+#include <commons/collections/mpmc_queue.h>
+
+#define OPERATIONS 2000000
+#define CAPACITY 1024
+
+static int64_t now_ns() {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (int64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+typedef struct {
+	t_queue *queue;
+	pthread_mutex_t mutex;
+} t_locked_queue;
+
+static int operations_per_thread;
+
+static void *locked_push_pop(void *args) {
+	t_locked_queue *locked = args;
+	for (intptr_t i = 0; i < operations_per_thread; i++) {
+		pthread_mutex_lock(&locked->mutex);
+		queue_push(locked->queue, (void*) i);
+		pthread_mutex_unlock(&locked->mutex);
+		pthread_mutex_lock(&locked->mutex);
+		queue_pop(locked->queue);
+		pthread_mutex_unlock(&locked->mutex);
+	}
+	return NULL;
+}
+
+static void *mpmc_push_pop(void *queue) {
+	for (intptr_t i = 0; i < operations_per_thread; i++) {
+		mpmc_queue_push(queue, (void*) i);
+		mpmc_queue_pop(queue);
+	}
+	return NULL;
+}
+
+static double measure(int threads, void *(*push_pop)(void*), void *queue) {
+	pthread_t workers[threads];
+	operations_per_thread = OPERATIONS / threads;
+
+	int64_t start = now_ns();
+	for (int i = 0; i < threads; i++) pthread_create(&workers[i], NULL, push_pop, queue);
+	for (int i = 0; i < threads; i++) pthread_join(workers[i], NULL);
+	int64_t elapsed = now_ns() - start;
+
+	return (double) operations_per_thread * threads * 2 * 1000 / elapsed;
+}
+
+void bench_mpmc_queue_scaling() {
+	/**
+	* @brief Operaciones por segundo con todos los hilos encolando y
+	*        desencolando sobre la misma cola, para 1 a 32 hilos.
+	*/
+	printf("bench_mpmc_queue_scaling (%d pares push+pop, M ops/s):\n", OPERATIONS);
+	for (int threads = 1; threads <= 32; threads *= 2) {
+		t_locked_queue locked = { .queue = queue_create_with_capacity(CAPACITY) };
+		pthread_mutex_init(&locked.mutex, NULL);
+		double locked_rate = measure(threads, locked_push_pop, &locked);
+		pthread_mutex_destroy(&locked.mutex);
+		queue_destroy(locked.queue);
+
+		t_mpmc_queue *mpmc = mpmc_queue_create(CAPACITY);
+		double mpmc_rate = measure(threads, mpmc_push_pop, mpmc);
+		mpmc_queue_destroy(mpmc);
+
+		printf("  %2d hilos: t_queue + mutex %6.2f, t_mpmc_queue %6.2f\n", threads, locked_rate, mpmc_rate);
+	}
+	printf("\n");
+}
+
+int main(int argc, char** argv) {
+	bench_mpmc_queue_scaling();
+
+	return (EXIT_SUCCESS);
+}
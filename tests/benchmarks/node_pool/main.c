@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <time.h>
+#include <commons/collections/list.h>
+#include <commons/collections/node_pool.h>
+
+#define ROUNDS 200
+#define ELEMENTS 10000
+
+static int64_t now_ns() {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (int64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+static void* churn_nodes(void* use_pool) {
+	t_node_pool* pool = use_pool ? node_pool_create(sizeof(t_link_element), DEFAULT_NODE_POOL_SLAB_SIZE) : NULL;
+	t_list* list = list_create_with_pool(pool);
+
+	for (int round = 0; round < ROUNDS; round++) {
+		for (intptr_t i = 0; i < ELEMENTS; i++) {
+			list_add(list, (void*) i);
+		}
+		list_clean(list);
+	}
+
+	list_destroy(list);
+	if (pool != NULL) {
+		node_pool_destroy(pool);
+	}
+	return NULL;
+}
+
+static double run_threads(int threads, bool use_pool) {
+	pthread_t workers[threads];
+
+	int64_t start = now_ns();
+	for (int i = 0; i < threads; i++) {
+		pthread_create(&workers[i], NULL, churn_nodes, use_pool ? (void*) 1 : NULL);
+	}
+	for (int i = 0; i < threads; i++) {
+		pthread_join(workers[i], NULL);
+	}
+	int64_t elapsed = now_ns() - start;
+
+	return (double) threads * ROUNDS * ELEMENTS / (elapsed / 1e9) / 1e6;
+}
+
+void bench_node_churn() {
+	/**
+	* @brief Cada hilo agrega y limpia su propia lista repetidas veces, con
+	*        nodos reservados con malloc() o tomados de un pool por hilo.
+	*/
+	int threads[] = { 1, 4, 16 };
+
+	printf("bench_node_churn (millones de add+remove por segundo):\n");
+	for (int i = 0; i < 3; i++) {
+		double with_malloc = run_threads(threads[i], false);
+		double with_pool = run_threads(threads[i], true);
+		printf("  %2d hilos: malloc %7.2f, pool %7.2f\n", threads[i], with_malloc, with_pool);
+	}
+	printf("\n");
+}
+
+int main(int argc, char** argv) {
+	bench_node_churn();
+
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <commons/collections/list.h>
+#include <commons/collections/priority_queue.h>
+
+#define READY_PROCESSES 10000
+
+typedef struct {
+	int pid;
+	double estimated_burst;
+	int handle;
+} t_pcb;
+
+static int64_t now_ns() {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (int64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+static bool shortest_burst(void *a, void *b) {
+	return ((t_pcb*) a)->estimated_burst <= ((t_pcb*) b)->estimated_burst;
+}
+
+static void *minimum_burst(void *a, void *b) {
+	return shortest_burst(a, b) ? a : b;
+}
+
+static t_pcb *pcbs_create() {
+	t_pcb *pcbs = malloc(READY_PROCESSES * sizeof(t_pcb));
+	srand(1);
+	for (int i = 0; i < READY_PROCESSES; i++) {
+		pcbs[i].pid = i;
+		pcbs[i].estimated_burst = rand() % 1000;
+	}
+	return pcbs;
+}
+
+static void pcb_reestimate(t_pcb *pcb) {
+	// Estimación SJF con alfa = 0.5 sobre una ráfaga real simulada
+	pcb->estimated_burst = 0.5 * pcb->estimated_burst + 0.5 * (rand() % 1000);
+}
+
+static void print_result(char *name, int decisions, int64_t elapsed_ns) {
+	printf("  %-40s %12.0f decisiones/s\n", name, decisions * 1e9 / elapsed_ns);
+}
+
+void bench_priority_queue_scheduling() {
+	/**
+	* @brief Planificador SJF con READY_PROCESSES procesos listos: cada
+	*        decisión elige el de menor ráfaga estimada, lo "ejecuta",
+	*        reestima su ráfaga y lo vuelve a poner en la cola de listos.
+	*/
+	t_pcb *pcbs = pcbs_create();
+
+	printf("bench_priority_queue_scheduling (%d procesos listos):\n", READY_PROCESSES);
+
+	int decisions = 200;
+	t_list *ready = list_create();
+	for (int i = 0; i < READY_PROCESSES; i++) list_add(ready, &pcbs[i]);
+	int64_t start = now_ns();
+	for (int i = 0; i < decisions; i++) {
+		list_sort(ready, shortest_burst);
+		t_pcb *next = list_remove(ready, 0);
+		pcb_reestimate(next);
+		list_add(ready, next);
+	}
+	print_result("list_sort + list_remove", decisions, now_ns() - start);
+	list_destroy(ready);
+
+	decisions = 5000;
+	ready = list_create();
+	for (int i = 0; i < READY_PROCESSES; i++) list_add(ready, &pcbs[i]);
+	start = now_ns();
+	for (int i = 0; i < decisions; i++) {
+		t_pcb *next = list_get_minimum(ready, minimum_burst);
+		list_remove_element(ready, next);
+		pcb_reestimate(next);
+		list_add(ready, next);
+	}
+	print_result("list_get_minimum + list_remove_element", decisions, now_ns() - start);
+	list_destroy(ready);
+
+	ready = list_create();
+	for (int i = 0; i < READY_PROCESSES; i++) list_add_sorted(ready, &pcbs[i], shortest_burst);
+	start = now_ns();
+	for (int i = 0; i < decisions; i++) {
+		t_pcb *next = list_remove(ready, 0);
+		pcb_reestimate(next);
+		list_add_sorted(ready, next, shortest_burst);
+	}
+	print_result("list_remove + list_add_sorted", decisions, now_ns() - start);
+	list_destroy(ready);
+
+	decisions = 1000000;
+	t_priority_queue *queue = priority_queue_create(shortest_burst);
+	for (int i = 0; i < READY_PROCESSES; i++) priority_queue_push(queue, &pcbs[i]);
+	start = now_ns();
+	for (int i = 0; i < decisions; i++) {
+		t_pcb *next = priority_queue_pop(queue);
+		pcb_reestimate(next);
+		priority_queue_push(queue, next);
+	}
+	print_result("priority_queue_pop + priority_queue_push", decisions, now_ns() - start);
+	priority_queue_destroy(queue);
+
+	free(pcbs);
+	printf("\n");
+}
+
+void bench_priority_queue_aging() {
+	/**
+	* @brief Envejecimiento: se mejora la prioridad de un proceso listo
+	*        cualquiera, reubicándolo con su handle o, sin handles,
+	*        buscándolo en la lista y reordenándola.
+	*/
+	t_pcb *pcbs = pcbs_create();
+
+	printf("bench_priority_queue_aging (%d procesos listos):\n", READY_PROCESSES);
+
+	int operations = 5000;
+	t_list *ready = list_create();
+	for (int i = 0; i < READY_PROCESSES; i++) list_add_sorted(ready, &pcbs[i], shortest_burst);
+	int64_t start = now_ns();
+	for (int i = 0; i < operations; i++) {
+		t_pcb *aged = &pcbs[rand() % READY_PROCESSES];
+		list_remove_element(ready, aged);
+		aged->estimated_burst *= 0.9;
+		list_add_sorted(ready, aged, shortest_burst);
+	}
+	print_result("list_remove_element + list_add_sorted", operations, now_ns() - start);
+	list_destroy(ready);
+
+	operations = 1000000;
+	t_priority_queue *queue = priority_queue_create(shortest_burst);
+	for (int i = 0; i < READY_PROCESSES; i++) pcbs[i].handle = priority_queue_push(queue, &pcbs[i]);
+	start = now_ns();
+	for (int i = 0; i < operations; i++) {
+		t_pcb *aged = &pcbs[rand() % READY_PROCESSES];
+		aged->estimated_burst *= 0.9;
+		priority_queue_update(queue, aged->handle);
+	}
+	print_result("priority_queue_update", operations, now_ns() - start);
+	priority_queue_destroy(queue);
+
+	free(pcbs);
+	printf("\n");
+}
+
+int main(int argc, char** argv) {
+	bench_priority_queue_scheduling();
+	bench_priority_queue_aging();
+
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <commons/collections/list.h>
+#include <commons/collections/queue.h>
+
+static int64_t now_ns() {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (int64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+void bench_queue_push_pop() {
+	/**
+	* @brief Encolar y desencolar manteniendo `waiting` elementos en espera,
+	*        con la lista que usaba t_queue antes del arreglo circular
+	*        (list_add + list_remove del primero) y con la cola actual.
+	*/
+	int operations = 10000000;
+
+	printf("bench_queue_push_pop (ns/par push+pop):\n");
+	for (int waiting = 1; waiting <= 100000; waiting *= 100) {
+		t_list *list = list_create();
+		for (intptr_t i = 0; i < waiting; i++) list_add(list, (void*) i);
+		int64_t start = now_ns();
+		for (intptr_t i = 0; i < operations; i++) {
+			list_add(list, (void*) i);
+			list_remove(list, 0);
+		}
+		double list_ns = (double) (now_ns() - start) / operations;
+		list_destroy(list);
+
+		t_queue *queue = queue_create();
+		for (intptr_t i = 0; i < waiting; i++) queue_push(queue, (void*) i);
+		start = now_ns();
+		for (intptr_t i = 0; i < operations; i++) {
+			queue_push(queue, (void*) i);
+			queue_pop(queue);
+		}
+		double queue_ns = (double) (now_ns() - start) / operations;
+		queue_destroy(queue);
+
+		printf("  %6d en espera: t_list %6.2f, t_queue %6.2f\n", waiting, list_ns, queue_ns);
+	}
+	printf("\n");
+}
+
+void bench_queue_batch() {
+	/**
+	* @brief Mover lotes de elementos de a uno o con queue_push_batch() y
+	*        queue_pop_batch().
+	*/
+	int operations = 10000000;
+
+	printf("bench_queue_batch (ns/elemento):\n");
+	for (int batch_size = 4; batch_size <= 256; batch_size *= 4) {
+		void **batch = malloc(batch_size * sizeof(void*));
+		for (intptr_t i = 0; i < batch_size; i++) batch[i] = (void*) i;
+
+		t_queue *queue = queue_create();
+		int64_t start = now_ns();
+		for (int done = 0; done < operations; done += batch_size) {
+			for (int i = 0; i < batch_size; i++) queue_push(queue, batch[i]);
+			for (int i = 0; i < batch_size; i++) batch[i] = queue_pop(queue);
+		}
+		double single_ns = (double) (now_ns() - start) / operations;
+
+		start = now_ns();
+		for (int done = 0; done < operations; done += batch_size) {
+			queue_push_batch(queue, batch, batch_size);
+			queue_pop_batch(queue, batch, batch_size);
+		}
+		double batch_ns = (double) (now_ns() - start) / operations;
+		queue_destroy(queue);
+		free(batch);
+
+		printf("  lotes de %3d: de a uno %5.2f, batch %5.2f\n", batch_size, single_ns, batch_ns);
+	}
+	printf("\n");
+}
+
+int main(int argc, char** argv) {
+	bench_queue_push_pop();
+	bench_queue_batch();
+
+	return (EXIT_SUCCESS);
+}
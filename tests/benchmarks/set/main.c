@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <commons/collections/list.h>
+#include <commons/collections/set.h>
+
+static int64_t now_ns() {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (int64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+void bench_set_membership() {
+	/**
+	* @brief Busca enteros (la mitad presentes) en un t_set y en una t_list
+	*        con `list_any_satisfy()`, para distintas cantidades de elementos.
+	*/
+	printf("bench_set_membership (ns/búsqueda):\n");
+	for (int size = 10; size <= 10000; size *= 10) {
+		t_set *set = set_create_int();
+		t_list *list = list_create();
+		for (uintptr_t number = 0; number < size; number++) {
+			set_add_int(set, number * 2);
+			list_add(list, (void*) (number * 2));
+		}
+
+		int lookups = 1000000;
+		int found = 0;
+		int64_t start = now_ns();
+		for (int i = 0; i < lookups; i++) {
+			found += set_contains_int(set, i % (size * 2));
+		}
+		double set_ns = (double) (now_ns() - start) / lookups;
+
+		int list_lookups = lookups / size;
+		start = now_ns();
+		for (int i = 0; i < list_lookups; i++) {
+			uintptr_t number = i % (size * 2);
+			bool _is_number(void *element) {
+				return (uintptr_t) element == number;
+			}
+			found += list_any_satisfy(list, _is_number);
+		}
+		double list_ns = (double) (now_ns() - start) / list_lookups;
+
+		printf("  %5d elementos: set %7.2f, list_any_satisfy %10.2f (%d encontrados)\n", size, set_ns, list_ns, found);
+		set_destroy(set);
+		list_destroy(list);
+	}
+	printf("\n");
+}
+
+void bench_set_string_membership() {
+	/**
+	* @brief Busca strings en un t_set y en una t_list con `list_any_satisfy()`
+	*        usando `strcmp()`.
+	*/
+	int size = 1000;
+	char key[32];
+	t_set *set = set_create();
+	t_list *list = list_create();
+	for (int i = 0; i < size; i++) {
+		sprintf(key, "proceso-%d", i * 2);
+		set_add(set, key);
+		list_add(list, strdup(key));
+	}
+
+	int lookups = 200000;
+	int found = 0;
+	int64_t start = now_ns();
+	for (int i = 0; i < lookups; i++) {
+		sprintf(key, "proceso-%d", i % (size * 2));
+		found += set_contains(set, key);
+	}
+	double set_ns = (double) (now_ns() - start) / lookups;
+
+	int list_lookups = lookups / 100;
+	start = now_ns();
+	for (int i = 0; i < list_lookups; i++) {
+		sprintf(key, "proceso-%d", i % (size * 2));
+		bool _is_key(void *element) {
+			return strcmp(element, key) == 0;
+		}
+		found += list_any_satisfy(list, _is_key);
+	}
+	double list_ns = (double) (now_ns() - start) / list_lookups;
+
+	printf("bench_set_string_membership (ns/búsqueda, %d strings):\n", size);
+	printf("  set %7.2f, list_any_satisfy %10.2f (%d encontrados)\n\n", set_ns, list_ns, found);
+	set_destroy(set);
+	list_destroy_and_destroy_elements(list, free);
+}
+
+void bench_set_algebra() {
+	/**
+	* @brief Mide la unión, intersección y diferencia entre un conjunto grande
+	*        y uno chico, en ambos órdenes de operandos.
+	*/
+	int large_size = 1000000, small_size = 1000;
+	t_set *large = set_create_int();
+	t_set *small = set_create_int();
+	for (uint64_t number = 0; number < large_size; number++) {
+		set_add_int(large, number * 2);
+	}
+	for (uint64_t number = 0; number < small_size; number++) {
+		set_add_int(small, number * 3);
+	}
+
+	printf("bench_set_algebra (ms, %d y %d elementos):\n", large_size, small_size);
+	struct {
+		char *name;
+		t_set *(*operation)(t_set*, t_set*);
+	} operations[] = {
+		{ "union", set_union },
+		{ "intersection", set_intersection },
+		{ "difference", set_difference },
+	};
+	for (int i = 0; i < sizeof(operations) / sizeof(operations[0]); i++) {
+		int64_t start = now_ns();
+		t_set *large_first = operations[i].operation(large, small);
+		double large_first_ms = (now_ns() - start) / 1e6;
+
+		start = now_ns();
+		t_set *small_first = operations[i].operation(small, large);
+		double small_first_ms = (now_ns() - start) / 1e6;
+
+		printf("  %-12s grande-chico %8.3f (%7d), chico-grande %8.3f (%7d)\n", operations[i].name,
+				large_first_ms, set_size(large_first), small_first_ms, set_size(small_first));
+		set_destroy(large_first);
+		set_destroy(small_first);
+	}
+	printf("\n");
+
+	set_destroy(large);
+	set_destroy(small);
+}
+
+int main(int argc, char** argv) {
+	bench_set_membership();
+	bench_set_string_membership();
+	bench_set_algebra();
+
+	return (EXIT_SUCCESS);
+}
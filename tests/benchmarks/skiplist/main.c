@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <pthread.h>
+#include <commons/collections/list.h>
+#include <commons/collections/skiplist.h>
+
+#define PRELOADED_KEYS 10000
+#define KEY_RANGE (2 * PRELOADED_KEYS)
+
+typedef struct {
+	unsigned seed;
+	int operations;
+} t_worker;
+
+static t_skiplist *shared_skiplist;
+static t_list *shared_list;
+static pthread_mutex_t list_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static int64_t now_ns() {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (int64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+static bool lower_key(void *a, void *b) {
+	return (uintptr_t) a <= (uintptr_t) b;
+}
+
+static void *skiplist_worker(void *argument) {
+	// 90% de búsquedas, 5% de altas y 5% de bajas
+	t_worker *worker = argument;
+	for (int i = 0; i < worker->operations; i++) {
+		uint64_t key = rand_r(&worker->seed) % KEY_RANGE;
+		int operation = rand_r(&worker->seed) % 20;
+		if (operation == 0) {
+			skiplist_insert(shared_skiplist, key, (void*) (uintptr_t) (key + 1));
+		} else if (operation == 1) {
+			skiplist_remove(shared_skiplist, key);
+		} else {
+			skiplist_find(shared_skiplist, key);
+		}
+	}
+	return NULL;
+}
+
+static void *list_worker(void *argument) {
+	// La misma carga sobre una lista ordenada protegida por un mutex global
+	t_worker *worker = argument;
+	for (int i = 0; i < worker->operations; i++) {
+		uintptr_t key = rand_r(&worker->seed) % KEY_RANGE;
+		int operation = rand_r(&worker->seed) % 20;
+		bool _has_key(void *element) {
+			return (uintptr_t) element == key;
+		}
+
+		pthread_mutex_lock(&list_mutex);
+		if (operation == 0) {
+			if (!list_any_satisfy(shared_list, _has_key)) {
+				list_add_sorted(shared_list, (void*) key, lower_key);
+			}
+		} else if (operation == 1) {
+			list_remove_by_condition(shared_list, _has_key);
+		} else {
+			list_find(shared_list, _has_key);
+		}
+		pthread_mutex_unlock(&list_mutex);
+	}
+	return NULL;
+}
+
+static double run_workers(void *(*work)(void*), int threads_count, int operations) {
+	pthread_t threads[threads_count];
+	t_worker workers[threads_count];
+	int64_t start = now_ns();
+	for (int i = 0; i < threads_count; i++) {
+		workers[i] = (t_worker) { .seed = i + 1, .operations = operations };
+		pthread_create(&threads[i], NULL, work, &workers[i]);
+	}
+	for (int i = 0; i < threads_count; i++) {
+		pthread_join(threads[i], NULL);
+	}
+	return (double) (now_ns() - start) / ((int64_t) operations * threads_count);
+}
+
+void bench_skiplist_read_heavy() {
+	/**
+	* @brief Varios hilos hacen 90% de búsquedas y 10% de altas y bajas sobre
+	*        un conjunto de PRELOADED_KEYS keys, con la skip list y con una
+	*        t_list ordenada protegida por un mutex.
+	*/
+	printf("bench_skiplist_read_heavy (ns/op, %d keys):\n", PRELOADED_KEYS);
+	for (int threads_count = 1; threads_count <= 8; threads_count *= 2) {
+		shared_skiplist = skiplist_create();
+		shared_list = list_create();
+		for (uintptr_t key = 0; key < KEY_RANGE; key += 2) {
+			skiplist_insert(shared_skiplist, key, (void*) (key + 1));
+			list_add(shared_list, (void*) key);
+		}
+
+		double skiplist_ns = run_workers(skiplist_worker, threads_count, 200000);
+		double list_ns = run_workers(list_worker, threads_count, 2000);
+
+		printf("  %d hilos: skiplist %8.2f, mutex + list %10.2f\n", threads_count, skiplist_ns, list_ns);
+		skiplist_destroy(shared_skiplist);
+		list_destroy(shared_list);
+	}
+	printf("\n");
+}
+
+int main(int argc, char** argv) {
+	bench_skiplist_read_heavy();
+
+	return (EXIT_SUCCESS);
+}
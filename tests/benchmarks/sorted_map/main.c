@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <commons/collections/list.h>
+#include <commons/collections/sorted_map.h>
+
+#define QUERIES 10000
+#define RANGE_SIZE 100
+
+typedef struct {
+	uint64_t base;
+	uint64_t size;
+} t_segment;
+
+static int64_t now_ns() {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (int64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+static uint64_t random_key() {
+	return ((uint64_t) rand() << 31 | rand()) % 1000000000000;
+}
+
+static bool lower_base(void *a, void *b) {
+	return ((t_segment*) a)->base <= ((t_segment*) b)->base;
+}
+
+static uint64_t visited_size;
+
+static void visit_segment(uint64_t key, void *segment) {
+	visited_size += ((t_segment*) segment)->size;
+}
+
+static t_segment *list_floor(t_list *segments, uint64_t address) {
+	// Último segmento cuya base es menor o igual a la dirección
+	t_segment *floor = NULL;
+	t_list_iterator *iterator = list_iterator_create(segments);
+	while (list_iterator_has_next(iterator)) {
+		t_segment *segment = list_iterator_next(iterator);
+		if (segment->base > address) {
+			break;
+		}
+		floor = segment;
+	}
+	list_iterator_destroy(iterator);
+	return floor;
+}
+
+static void list_iterate_range(t_list *segments, uint64_t from, uint64_t to) {
+	t_list_iterator *iterator = list_iterator_create(segments);
+	while (list_iterator_has_next(iterator)) {
+		t_segment *segment = list_iterator_next(iterator);
+		if (segment->base > to) {
+			break;
+		}
+		if (segment->base >= from) {
+			visited_size += segment->size;
+		}
+	}
+	list_iterator_destroy(iterator);
+}
+
+void bench_sorted_map_segments(int size, bool with_list) {
+	/**
+	* @brief Tabla de segmentos ordenada por base: inserta `size` segmentos,
+	*        busca el que contiene direcciones al azar, recorre rangos de
+	*        RANGE_SIZE segmentos y los quita en orden.
+	*/
+	t_segment *segments = malloc(size * sizeof(t_segment));
+	uint64_t *addresses = malloc(QUERIES * sizeof(uint64_t));
+	srand(size);
+	for (int i = 0; i < size; i++) {
+		segments[i] = (t_segment) { .base = random_key(), .size = 1 + rand() % 4096 };
+	}
+	for (int i = 0; i < QUERIES; i++) {
+		addresses[i] = random_key();
+	}
+	uint64_t range_width = 1000000000000 / size * RANGE_SIZE;
+
+	t_sorted_map *map = sorted_map_create();
+	int64_t start = now_ns();
+	for (int i = 0; i < size; i++) {
+		sorted_map_put(map, segments[i].base, &segments[i]);
+	}
+	double put_ns = (double) (now_ns() - start) / size;
+
+	start = now_ns();
+	for (int i = 0; i < QUERIES; i++) {
+		sorted_map_floor(map, addresses[i], NULL);
+	}
+	double floor_ns = (double) (now_ns() - start) / QUERIES;
+
+	start = now_ns();
+	for (int i = 0; i < QUERIES; i++) {
+		sorted_map_iterate_range(map, addresses[i], addresses[i] + range_width, visit_segment);
+	}
+	double range_ns = (double) (now_ns() - start) / QUERIES;
+
+	int count = sorted_map_size(map);
+	start = now_ns();
+	while (!sorted_map_is_empty(map)) {
+		sorted_map_remove_min(map, NULL);
+	}
+	double remove_ns = (double) (now_ns() - start) / count;
+	sorted_map_destroy(map);
+
+	printf("  %8d segmentos, sorted_map: put %8.2f, floor %10.2f, rango %10.2f, quitar menor %8.2f\n",
+			size, put_ns, floor_ns, range_ns, remove_ns);
+
+	if (with_list) {
+		t_list *list = list_create();
+		start = now_ns();
+		for (int i = 0; i < size; i++) {
+			list_add_sorted(list, &segments[i], lower_base);
+		}
+		put_ns = (double) (now_ns() - start) / size;
+
+		start = now_ns();
+		for (int i = 0; i < QUERIES; i++) {
+			list_floor(list, addresses[i]);
+		}
+		floor_ns = (double) (now_ns() - start) / QUERIES;
+
+		start = now_ns();
+		for (int i = 0; i < QUERIES; i++) {
+			list_iterate_range(list, addresses[i], addresses[i] + range_width);
+		}
+		range_ns = (double) (now_ns() - start) / QUERIES;
+
+		start = now_ns();
+		while (!list_is_empty(list)) {
+			list_remove(list, 0);
+		}
+		remove_ns = (double) (now_ns() - start) / size;
+		list_destroy(list);
+
+		printf("  %8d segmentos, list:       put %8.2f, floor %10.2f, rango %10.2f, quitar menor %8.2f\n",
+				size, put_ns, floor_ns, range_ns, remove_ns);
+	}
+
+	free(addresses);
+	free(segments);
+}
+
+int main(int argc, char** argv) {
+	printf("bench_sorted_map_segments (ns/op):\n");
+	// list_add_sorted es O(n) por inserción: con más de 10^4 segmentos la
+	// lista tarda minutos en armarse
+	for (int size = 1000; size <= 1000000; size *= 10) {
+		bench_sorted_map_segments(size, size <= 10000);
+	}
+	printf("\n");
+
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <commons/collections/queue.h>
+#include <commons/collections/blocking_queue.h>
+#include <commons/collections/spsc_queue.h>
+
+#define MESSAGES 10000000
+#define CAPACITY 1024
+
+static int64_t now_ns() {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (int64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+/********* t_queue + mutex **************/
+
+typedef struct {
+	t_queue *queue;
+	pthread_mutex_t mutex;
+} t_locked_queue;
+
+static void *locked_produce(void *args) {
+	t_locked_queue *locked = args;
+	for (intptr_t i = 1; i <= MESSAGES; ) {
+		pthread_mutex_lock(&locked->mutex);
+		bool full = queue_size(locked->queue) == CAPACITY;
+		if (!full) {
+			queue_push(locked->queue, (void*) i++);
+		}
+		pthread_mutex_unlock(&locked->mutex);
+		if (full) {
+			sched_yield();
+		}
+	}
+	return NULL;
+}
+
+static void locked_consume(t_locked_queue *locked) {
+	for (int received = 0; received < MESSAGES; ) {
+		pthread_mutex_lock(&locked->mutex);
+		bool empty = queue_is_empty(locked->queue);
+		if (!empty) {
+			queue_pop(locked->queue);
+			received++;
+		}
+		pthread_mutex_unlock(&locked->mutex);
+		if (empty) {
+			sched_yield();
+		}
+	}
+}
+
+/********* t_blocking_queue **************/
+
+static void *blocking_produce(void *queue) {
+	for (intptr_t i = 1; i <= MESSAGES; i++) {
+		blocking_queue_push(queue, (void*) i);
+	}
+	return NULL;
+}
+
+static void blocking_consume(t_blocking_queue *queue) {
+	void *element;
+	for (int received = 0; received < MESSAGES; received++) {
+		blocking_queue_pop(queue, &element);
+	}
+}
+
+/********* t_spsc_queue **************/
+
+static void *spsc_produce(void *queue) {
+	for (intptr_t i = 1; i <= MESSAGES; i++) {
+		while (!spsc_queue_try_push(queue, (void*) i)) {
+			sched_yield();
+		}
+	}
+	return NULL;
+}
+
+static void spsc_consume(t_spsc_queue *queue, int batch_size) {
+	void *elements[batch_size];
+	for (int received = 0; received < MESSAGES; ) {
+		int count = spsc_queue_pop_batch(queue, elements, batch_size);
+		if (count == 0) {
+			sched_yield();
+		}
+		received += count;
+	}
+}
+
+static void print_rate(char *name, int64_t elapsed) {
+	printf("  %-26s: %7.2f M mensajes/s\n", name, (double) MESSAGES * 1000 / elapsed);
+}
+
+void bench_spsc_queue() {
+	/**
+	* @brief Mensajes por segundo entre un único productor y un único
+	*        consumidor, con el consumidor en el hilo principal.
+	*/
+	pthread_t producer;
+	int64_t start;
+
+	printf("bench_spsc_queue (%d mensajes, capacidad %d):\n", MESSAGES, CAPACITY);
+
+	t_locked_queue locked = { .queue = queue_create_with_capacity(CAPACITY) };
+	pthread_mutex_init(&locked.mutex, NULL);
+	start = now_ns();
+	pthread_create(&producer, NULL, locked_produce, &locked);
+	locked_consume(&locked);
+	pthread_join(producer, NULL);
+	print_rate("t_queue + mutex", now_ns() - start);
+	pthread_mutex_destroy(&locked.mutex);
+	queue_destroy(locked.queue);
+
+	t_blocking_queue *blocking = blocking_queue_create(CAPACITY);
+	start = now_ns();
+	pthread_create(&producer, NULL, blocking_produce, blocking);
+	blocking_consume(blocking);
+	pthread_join(producer, NULL);
+	print_rate("t_blocking_queue", now_ns() - start);
+	blocking_queue_destroy(blocking);
+
+	for (int batch_size = 1; batch_size <= 64; batch_size *= 8) {
+		t_spsc_queue *spsc = spsc_queue_create(CAPACITY);
+		start = now_ns();
+		pthread_create(&producer, NULL, spsc_produce, spsc);
+		spsc_consume(spsc, batch_size);
+		pthread_join(producer, NULL);
+
+		char name[64];
+		snprintf(name, sizeof(name), "t_spsc_queue (lotes de %d)", batch_size);
+		print_rate(name, now_ns() - start);
+		spsc_queue_destroy(spsc);
+	}
+	printf("\n");
+}
+
+int main(int argc, char** argv) {
+	bench_spsc_queue();
+
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <commons/collections/list.h>
+#include <commons/collections/stream.h>
+
+#define ELEMENTS 1000000
+
+static int64_t now_ns() {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (int64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+static bool is_even(void *number) {
+	return (intptr_t) number % 2 == 0;
+}
+
+static void *triple(void *number) {
+	return (void*) ((intptr_t) number * 3);
+}
+
+static void *sum(void *number1, void *number2) {
+	return (void*) ((intptr_t) number1 + (intptr_t) number2);
+}
+
+static intptr_t eager_pipeline(t_list *numbers, int count) {
+	t_list *filtered = list_filter(numbers, is_even);
+	t_list *mapped = list_map(filtered, triple);
+	t_list *taken = list_take(mapped, count);
+	intptr_t result = (intptr_t) list_fold(taken, 0, sum);
+	list_destroy(filtered);
+	list_destroy(mapped);
+	list_destroy(taken);
+	return result;
+}
+
+static intptr_t stream_pipeline(t_list *numbers, int count) {
+	t_stream *stream = stream_of(numbers);
+	stream = stream_filter(stream, is_even);
+	stream = stream_map(stream, triple);
+	stream = stream_take(stream, count);
+	return (intptr_t) stream_fold(stream, 0, sum);
+}
+
+void bench_stream_pipeline() {
+	/**
+	* @brief filter → map → take → fold sobre ELEMENTS números, encadenando
+	*        las funciones de list.h o con un stream, tomando desde los
+	*        primeros 10 resultados hasta todos.
+	*/
+	t_list *numbers = list_create();
+	for (intptr_t i = 0; i < ELEMENTS; i++) list_add(numbers, (void*) i);
+
+	printf("bench_stream_pipeline (us, %d elementos):\n", ELEMENTS);
+	int counts[] = { 10, 1000, 100000, ELEMENTS };
+	for (int c = 0; c < 4; c++) {
+		int count = counts[c];
+		int repetitions = count < 1000 ? 20 : 5;
+
+		int64_t start = now_ns();
+		intptr_t eager_result = 0;
+		for (int i = 0; i < repetitions; i++) eager_result = eager_pipeline(numbers, count);
+		double eager_us = (now_ns() - start) / 1e3 / repetitions;
+
+		start = now_ns();
+		intptr_t stream_result = 0;
+		for (int i = 0; i < repetitions; i++) stream_result = stream_pipeline(numbers, count);
+		double stream_us = (now_ns() - start) / 1e3 / repetitions;
+
+		printf("  take %7d: listas encadenadas %10.1f, stream %10.1f%s\n", count, eager_us, stream_us,
+				eager_result == stream_result ? "" : " (resultados distintos!)");
+	}
+
+	list_destroy(numbers);
+	printf("\n");
+}
+
+int main(int argc, char** argv) {
+	bench_stream_pipeline();
+
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <time.h>
+#include <commons/threadpool.h>
+
+#define REQUESTS 100000
+
+static t_threadpool *pool;
+
+static int64_t now_ns() {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (int64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+static void *handle_request(void *request) {
+	intptr_t checksum = (intptr_t) request;
+	for (int i = 0; i < 100; i++) {
+		checksum = checksum * 31 + i;
+	}
+	return (void*) checksum;
+}
+
+static void *fibonacci(void *number) {
+	intptr_t n = (intptr_t) number;
+	if (n < 2) {
+		return (void*) n;
+	}
+	t_future *previous = threadpool_submit(pool, fibonacci, (void*) (n - 1));
+	intptr_t before_previous = (intptr_t) fibonacci((void*) (n - 2));
+	return (void*) ((intptr_t) threadpool_join(pool, previous) + before_previous);
+}
+
+void bench_threadpool_requests() {
+	/**
+	* @brief Atender REQUESTS pedidos cortos creando un hilo por pedido o
+	*        enviándolos a un pool de hilos, de a lotes de 64.
+	*/
+	int batch_size = 64;
+	pthread_t threads[64];
+	t_future *futures[64];
+
+	printf("bench_threadpool_requests (%d pedidos):\n", REQUESTS);
+
+	int64_t start = now_ns();
+	for (intptr_t done = 0; done < REQUESTS; done += batch_size) {
+		for (int i = 0; i < batch_size; i++) pthread_create(&threads[i], NULL, handle_request, (void*) (done + i));
+		for (int i = 0; i < batch_size; i++) pthread_join(threads[i], NULL);
+	}
+	printf("  pthread por pedido: %10.0f ns/pedido\n", (double) (now_ns() - start) / REQUESTS);
+
+	for (int workers = 1; workers <= 4; workers *= 2) {
+		pool = threadpool_create(workers);
+		start = now_ns();
+		for (intptr_t done = 0; done < REQUESTS; done += batch_size) {
+			for (int i = 0; i < batch_size; i++) futures[i] = threadpool_submit(pool, handle_request, (void*) (done + i));
+			for (int i = 0; i < batch_size; i++) threadpool_join(pool, futures[i]);
+		}
+		printf("  pool de %d hilos:    %10.0f ns/pedido\n", workers, (double) (now_ns() - start) / REQUESTS);
+		threadpool_destroy(pool);
+	}
+	printf("\n");
+}
+
+void bench_threadpool_fork_join() {
+	/**
+	* @brief Fibonacci recursivo donde cada llamada envía una de sus dos
+	*        ramas como tarea nueva: mide el costo de submit y join desde
+	*        los hilos del pool, que van a su deque y se roban entre hilos.
+	*/
+	int n = 22;
+
+	printf("bench_threadpool_fork_join (fibonacci(%d)):\n", n);
+	for (int workers = 1; workers <= 4; workers *= 2) {
+		pool = threadpool_create(workers);
+		int64_t start = now_ns();
+		t_future *future = threadpool_submit(pool, fibonacci, (void*) (intptr_t) n);
+		intptr_t result = (intptr_t) threadpool_join(pool, future);
+		int64_t elapsed = now_ns() - start;
+		printf("  pool de %d hilos: %8.2f ms (resultado %ld)\n", workers, elapsed / 1e6, (long) result);
+		threadpool_destroy(pool);
+	}
+	printf("\n");
+}
+
+int main(int argc, char** argv) {
+	bench_threadpool_requests();
+	bench_threadpool_fork_join();
+
+	return (EXIT_SUCCESS);
+}
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <commons/temporal.h>
+#include <commons/timer_wheel.h>
+#include <commons/collections/list.h>
+
+#define OUTSTANDING_TIMERS 1000000
+#define MAX_DELAY_MS 600000
+
+typedef struct {
+	t_temporal *clock;
+	int64_t sleep_ms;
+} t_sleeping;
+
+static long expired_count;
+
+static int64_t now_ns() {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (int64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+static void count_expiration(void *data) {
+	expired_count++;
+}
+
+void bench_timer_wheel_outstanding() {
+	/**
+	* @brief Programar OUTSTANDING_TIMERS timers con demoras de hasta 10
+	*        minutos, cancelar la mitad y expirar el resto avanzando la rueda
+	*        de a 1 ms.
+	*/
+	t_timer **timers = malloc(OUTSTANDING_TIMERS * sizeof(t_timer*));
+	t_timer_wheel *wheel = timer_wheel_create();
+	srand(1);
+
+	printf("bench_timer_wheel_outstanding (%d timers):\n", OUTSTANDING_TIMERS);
+
+	int64_t start = now_ns();
+	for (int i = 0; i < OUTSTANDING_TIMERS; i++) {
+		timers[i] = timer_wheel_schedule(wheel, 1 + rand() % MAX_DELAY_MS, count_expiration, NULL);
+	}
+	printf("  schedule:            %8.2f ns/timer\n", (double) (now_ns() - start) / OUTSTANDING_TIMERS);
+
+	// Con todos los timers pendientes, avanzar 1 ms es lo que paga el
+	// planificador en cada vuelta
+	int ticks = 10000;
+	expired_count = 0;
+	start = now_ns();
+	for (int64_t tick = 1; tick <= ticks; tick++) {
+		timer_wheel_advance_to(wheel, tick);
+	}
+	printf("  advance 1 ms:        %8.2f ns/tick (%ld expirados)\n", (double) (now_ns() - start) / ticks, expired_count);
+
+	int cancelled = 0;
+	start = now_ns();
+	for (int i = 0; i < OUTSTANDING_TIMERS; i += 2) {
+		if (timers[i]->expiration_ms > ticks) {
+			timer_wheel_cancel(wheel, timers[i]);
+			cancelled++;
+		}
+	}
+	printf("  cancel:              %8.2f ns/timer\n", (double) (now_ns() - start) / cancelled);
+
+	int pending = timer_wheel_size(wheel);
+	expired_count = 0;
+	start = now_ns();
+	for (int64_t tick = ticks + 1; tick <= MAX_DELAY_MS; tick++) {
+		timer_wheel_advance_to(wheel, tick);
+	}
+	printf("  expire:              %8.2f ns/timer (%ld de %d)\n", (double) (now_ns() - start) / pending, expired_count, pending);
+
+	timer_wheel_destroy(wheel);
+	free(timers);
+	printf("\n");
+}
+
+void bench_timer_wheel_polling() {
+	/**
+	* @brief Costo de revisar en cada tick qué procesos terminaron de dormir:
+	*        recorriendo una lista de t_temporal con temporal_gettime() o
+	*        avanzando la rueda, con OUTSTANDING_TIMERS procesos dormidos.
+	*/
+	srand(1);
+	printf("bench_timer_wheel_polling (%d procesos dormidos):\n", OUTSTANDING_TIMERS);
+
+	t_list *sleeping = list_create();
+	for (int i = 0; i < OUTSTANDING_TIMERS; i++) {
+		t_sleeping *process = malloc(sizeof(t_sleeping));
+		process->clock = temporal_create();
+		process->sleep_ms = 1 + rand() % MAX_DELAY_MS;
+		list_add(sleeping, process);
+	}
+
+	int ticks = 5;
+	long woken = 0;
+	int64_t start = now_ns();
+	for (int tick = 0; tick < ticks; tick++) {
+		t_link_element *element = sleeping->head;
+		while (element != NULL) {
+			t_sleeping *process = element->data;
+			if (temporal_gettime(process->clock) >= process->sleep_ms) {
+				woken++;
+			}
+			element = element->next;
+		}
+	}
+	double polling_ns = (double) (now_ns() - start) / ticks;
+
+	void _destroy_sleeping(t_sleeping *process) {
+		temporal_destroy(process->clock);
+		free(process);
+	}
+	list_destroy_and_destroy_elements(sleeping, (void*) _destroy_sleeping);
+
+	t_timer_wheel *wheel = timer_wheel_create();
+	for (int i = 0; i < OUTSTANDING_TIMERS; i++) {
+		timer_wheel_schedule(wheel, 1 + rand() % MAX_DELAY_MS, count_expiration, NULL);
+	}
+	ticks = 10000;
+	start = now_ns();
+	for (int64_t tick = 1; tick <= ticks; tick++) {
+		timer_wheel_advance_to(wheel, tick);
+	}
+	double wheel_ns = (double) (now_ns() - start) / ticks;
+	timer_wheel_destroy(wheel);
+
+	printf("  lista de t_temporal: %12.0f ns/tick (%ld despertados)\n", polling_ns, woken);
+	printf("  t_timer_wheel:       %12.0f ns/tick\n", wheel_ns);
+	printf("\n");
+}
+
+int main(int argc, char** argv) {
+	bench_timer_wheel_outstanding();
+	bench_timer_wheel_polling();
+
+	return (EXIT_SUCCESS);
+}
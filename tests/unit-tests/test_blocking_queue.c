@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <commons/collections/blocking_queue.h>
+#include <cspecs/cspec.h>
+
+#define PRODUCERS 4
+#define CONSUMERS 4
+#define ELEMENTS_PER_PRODUCER 10000
+
+static t_blocking_queue *shared_queue;
+
+static void *produce(void *first) {
+    for (intptr_t i = 0; i < ELEMENTS_PER_PRODUCER; i++) {
+        blocking_queue_push(shared_queue, (void*) ((intptr_t) first + i));
+    }
+    return NULL;
+}
+
+static void *consume(void *_) {
+    intptr_t sum = 0;
+    void *element;
+    while (blocking_queue_pop(shared_queue, &element)) {
+        sum += (intptr_t) element;
+    }
+    return (void*) sum;
+}
+
+static void *close_later(void *queue) {
+    struct timespec delay = { .tv_sec = 0, .tv_nsec = 20000000 };
+    nanosleep(&delay, NULL);
+    blocking_queue_close(queue);
+    return NULL;
+}
+
+context (test_blocking_queue) {
+
+    describe ("Blocking queue") {
+
+        t_blocking_queue *queue;
+
+        before {
+            queue = blocking_queue_create(2);
+        } end
+
+        after {
+            blocking_queue_destroy(queue);
+        } end
+
+        it ("should pop the elements in the order they were pushed") {
+            void *element;
+
+            should_bool(blocking_queue_push(queue, (void*) 1)) be truthy;
+            should_bool(blocking_queue_push(queue, (void*) 2)) be truthy;
+            should_int(blocking_queue_size(queue)) be equal to(2);
+
+            should_bool(blocking_queue_pop(queue, &element)) be truthy;
+            should_int((intptr_t) element) be equal to(1);
+            should_bool(blocking_queue_pop(queue, &element)) be truthy;
+            should_int((intptr_t) element) be equal to(2);
+        } end
+
+        it ("should not wait when trying to push into a full queue") {
+            blocking_queue_push(queue, (void*) 1);
+            blocking_queue_push(queue, (void*) 2);
+
+            should_bool(blocking_queue_try_push(queue, (void*) 3)) be falsey;
+            should_bool(blocking_queue_timed_push(queue, (void*) 3, 10)) be falsey;
+            should_int(blocking_queue_size(queue)) be equal to(2);
+        } end
+
+        it ("should not wait when trying to pop from an empty queue") {
+            void *element = NULL;
+
+            should_bool(blocking_queue_try_pop(queue, &element)) be falsey;
+            should_bool(blocking_queue_timed_pop(queue, &element, 10)) be falsey;
+            should_ptr(element) be null;
+        } end
+
+        it ("should drain the waiting elements without blocking") {
+            void *elements[4];
+            blocking_queue_push(queue, (void*) 1);
+            blocking_queue_push(queue, (void*) 2);
+
+            should_int(blocking_queue_drain(queue, elements, 4)) be equal to(2);
+            should_int((intptr_t) elements[0]) be equal to(1);
+            should_int((intptr_t) elements[1]) be equal to(2);
+            should_int(blocking_queue_drain(queue, elements, 4)) be equal to(0);
+        } end
+
+        it ("should reject pushes but deliver the waiting elements after closing") {
+            void *element;
+            blocking_queue_push(queue, (void*) 1);
+
+            blocking_queue_close(queue);
+
+            should_bool(blocking_queue_is_closed(queue)) be truthy;
+            should_bool(blocking_queue_push(queue, (void*) 2)) be falsey;
+            should_bool(blocking_queue_pop(queue, &element)) be truthy;
+            should_int((intptr_t) element) be equal to(1);
+            should_bool(blocking_queue_pop(queue, &element)) be falsey;
+        } end
+
+        it ("should wake up a waiting consumer when closing") {
+            pthread_t closer;
+            void *element;
+            pthread_create(&closer, NULL, close_later, queue);
+
+            should_bool(blocking_queue_pop(queue, &element)) be falsey;
+
+            pthread_join(closer, NULL);
+        } end
+
+        it ("should deliver every element once with several producers and consumers") {
+            pthread_t producers[PRODUCERS], consumers[CONSUMERS];
+            shared_queue = queue;
+
+            for (int i = 0; i < CONSUMERS; i++) {
+                pthread_create(&consumers[i], NULL, consume, NULL);
+            }
+            for (intptr_t i = 0; i < PRODUCERS; i++) {
+                pthread_create(&producers[i], NULL, produce, (void*) (i * ELEMENTS_PER_PRODUCER));
+            }
+            for (int i = 0; i < PRODUCERS; i++) {
+                pthread_join(producers[i], NULL);
+            }
+            blocking_queue_close(queue);
+
+            intptr_t sum = 0;
+            for (int i = 0; i < CONSUMERS; i++) {
+                void *partial_sum;
+                pthread_join(consumers[i], &partial_sum);
+                sum += (intptr_t) partial_sum;
+            }
+
+            intptr_t total = PRODUCERS * ELEMENTS_PER_PRODUCER;
+            should_int(sum) be equal to(total * (total - 1) / 2);
+        } end
+
+    } end
+
+}
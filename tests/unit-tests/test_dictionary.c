@@ -17,6 +17,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <stdint.h>
 #include <commons/string.h>
 #include <commons/collections/dictionary.h>
 #include <cspecs/cspec.h>
@@ -38,6 +39,20 @@ static void persona_destroy(t_person *self){
 	free(self);
 }
 
+static int home_group(unsigned int hashcode) {
+	// Grupo inicial en una tabla de 1024 posiciones (64 grupos de 16)
+	return (hashcode >> 7) & 63;
+}
+
+static unsigned int hashcode_of(t_dictionary* self, char* key) {
+	for (int i = 0; i < self->table.table_max_size; i++) {
+		if (self->table.control[i] < 0 && strcmp(self->table.elements[i].key, key) == 0) {
+			return self->table.elements[i].hashcode;
+		}
+	}
+	return 0;
+}
+
 context (test_dictionary) {
 
     void assert_person(t_person *person, char* name, int age) {
@@ -184,6 +199,373 @@ context (test_dictionary) {
 
         } end
 
+        describe ("Collisions and growth") {
+
+            it("should keep keys whose hashes are equal as different entries") {
+                // Se buscan dos claves con la misma etiqueta de control (los 7
+                // bits bajos del hash) y el mismo grupo inicial con la semilla 42,
+                // para que la búsqueda tenga que comparar las claves completas
+                t_dictionary* probe = dictionary_create_with_seed(42);
+                char* first_key_by_bits[1 << 13] = { NULL };
+                char* first = NULL;
+                char* second = NULL;
+                for (int i = 0; second == NULL; i++) {
+                    char* key = string_from_format("pid-%d", i);
+                    dictionary_put(probe, key, NULL);
+                    int bits = hashcode_of(probe, key) & ((1 << 13) - 1);
+                    if (first_key_by_bits[bits] != NULL) {
+                        first = first_key_by_bits[bits];
+                        second = key;
+                    } else {
+                        first_key_by_bits[bits] = key;
+                    }
+                }
+
+                t_dictionary* colliding = dictionary_create_with_seed(42);
+                dictionary_put(colliding, first, persona_create("Matias", 24));
+                dictionary_put(colliding, second, persona_create("Gaston", 25));
+
+                should_int(hashcode_of(colliding, first) & 0x7F) be equal to(hashcode_of(colliding, second) & 0x7F);
+                should_int(home_group(hashcode_of(colliding, first))) be equal to(home_group(hashcode_of(colliding, second)));
+                should_int(dictionary_size(colliding)) be equal to(2);
+                assert_person(dictionary_get(colliding, first), "Matias", 24);
+                assert_person(dictionary_get(colliding, second), "Gaston", 25);
+
+                dictionary_remove_and_destroy(colliding, first, (void*) persona_destroy);
+                should_ptr(dictionary_get(colliding, first)) be null;
+                assert_person(dictionary_get(colliding, second), "Gaston", 25);
+                dictionary_remove_and_destroy(colliding, second, (void*) persona_destroy);
+                should_ptr(dictionary_get(colliding, second)) be null;
+                should_bool(dictionary_is_empty(colliding)) be truthy;
+
+                dictionary_destroy(colliding);
+                dictionary_destroy(probe);
+                for (int i = 0; i < 1 << 13; i++) {
+                    free(first_key_by_bits[i]);
+                }
+                free(second);
+            } end
+
+            it("should find every key after growing several times") {
+                for (int i = 0; i < 1000; i++) {
+                    char* key = string_itoa(i);
+                    dictionary_put(dictionary, key, persona_create(key, i % 256));
+                    free(key);
+                }
+
+                should_int(dictionary_size(dictionary)) be equal to(1000);
+                for (int i = 0; i < 1000; i++) {
+                    char* key = string_itoa(i);
+                    assert_person(dictionary_get(dictionary, key), key, i % 256);
+                    free(key);
+                }
+                should_bool(dictionary_has_key(dictionary, "1000")) be falsey;
+            } end
+
+            it("should find every key after removing and adding many times") {
+                for (int round = 0; round < 50; round++) {
+                    for (int i = 0; i < 20; i++) {
+                        char* key = string_from_format("%d-%d", round, i);
+                        dictionary_put(dictionary, key, persona_create(key, i));
+                        free(key);
+                    }
+                    for (int i = 0; i < 20; i += 2) {
+                        char* key = string_from_format("%d-%d", round, i);
+                        dictionary_remove_and_destroy(dictionary, key, (void*) persona_destroy);
+                        free(key);
+                    }
+                }
+
+                should_int(dictionary_size(dictionary)) be equal to(50 * 10);
+                for (int round = 0; round < 50; round++) {
+                    for (int i = 0; i < 20; i++) {
+                        char* key = string_from_format("%d-%d", round, i);
+                        should_bool(dictionary_has_key(dictionary, key)) be equal to(i % 2 == 1);
+                        free(key);
+                    }
+                }
+            } end
+
+        } end
+
+        describe ("Incremental resize") {
+
+            before {
+                dictionary_set_incremental_resize(dictionary, true);
+            } end
+
+            it("should find every key while both tables are in use") {
+                for (int i = 0; i < 900; i++) {
+                    char* key = string_itoa(i);
+                    dictionary_put(dictionary, key, persona_create(key, i % 256));
+                    free(key);
+
+                    should_int(dictionary_size(dictionary)) be equal to(i + 1);
+                }
+
+                should_ptr(dictionary->previous_table.elements) not be null;
+                for (int i = 0; i < 900; i++) {
+                    char* key = string_itoa(i);
+                    assert_person(dictionary_get(dictionary, key), key, i % 256);
+                    free(key);
+                }
+            } end
+
+            it("should remove, update and iterate keys while both tables are in use") {
+                for (int i = 0; i < 460; i++) {
+                    char* key = string_itoa(i);
+                    dictionary_put(dictionary, key, persona_create(key, i % 256));
+                    free(key);
+                }
+                should_ptr(dictionary->previous_table.elements) not be null;
+
+                for (int i = 0; i < 460; i += 2) {
+                    char* key = string_itoa(i);
+                    dictionary_remove_and_destroy(dictionary, key, (void*) persona_destroy);
+                    free(key);
+                }
+                t_person* old = dictionary_get(dictionary, "1");
+                dictionary_put(dictionary, "1", persona_create("Matias", 24));
+                persona_destroy(old);
+
+                int count = 0;
+                void _count(char* key, void* element) {
+                    count++;
+                }
+                dictionary_iterator(dictionary, _count);
+
+                should_int(count) be equal to(230);
+                should_int(dictionary_size(dictionary)) be equal to(230);
+                assert_person(dictionary_get(dictionary, "1"), "Matias", 24);
+                should_ptr(dictionary_get(dictionary, "2")) be null;
+            } end
+
+            it("should finish the pending migration when it is disabled") {
+                for (int i = 0; i < 500; i++) {
+                    char* key = string_itoa(i);
+                    dictionary_put(dictionary, key, persona_create(key, i % 256));
+                    free(key);
+                }
+
+                dictionary_set_incremental_resize(dictionary, false);
+
+                should_ptr(dictionary->previous_table.elements) be null;
+                should_int(dictionary_size(dictionary)) be equal to(500);
+                assert_person(dictionary_get(dictionary, "499"), "499", 499 % 256);
+            } end
+
+        } end
+
+        describe ("Capacity") {
+
+            void put_people(t_dictionary* self, int from, int to) {
+                for (int i = from; i < to; i++) {
+                    char* key = string_itoa(i);
+                    dictionary_put(self, key, persona_create(key, i % 256));
+                    free(key);
+                }
+            }
+
+            it("should not resize while the given capacity is not exceeded") {
+                t_dictionary* presized = dictionary_create_with_capacity(1000);
+                int table_max_size = presized->table.table_max_size;
+
+                put_people(presized, 0, 1000);
+
+                should_int(presized->table.table_max_size) be equal to(table_max_size);
+                should_int(dictionary_size(presized)) be equal to(1000);
+                assert_person(dictionary_get(presized, "999"), "999", 999 % 256);
+
+                dictionary_destroy_and_destroy_elements(presized, (void*) persona_destroy);
+            } end
+
+            it("should reserve capacity keeping the elements") {
+                put_people(dictionary, 0, 10);
+
+                dictionary_reserve(dictionary, 1000);
+                int table_max_size = dictionary->table.table_max_size;
+                assert_person(dictionary_get(dictionary, "5"), "5", 5);
+                put_people(dictionary, 10, 1000);
+
+                should_int(dictionary->table.table_max_size) be equal to(table_max_size);
+                should_int(dictionary_size(dictionary)) be equal to(1000);
+            } end
+
+            it("should not shrink when reserving less than its capacity") {
+                dictionary_reserve(dictionary, 1000);
+                int table_max_size = dictionary->table.table_max_size;
+
+                dictionary_reserve(dictionary, 10);
+
+                should_int(dictionary->table.table_max_size) be equal to(table_max_size);
+            } end
+
+            it("should keep its load under the max load factor") {
+                dictionary_set_max_load_factor(dictionary, 0.5);
+
+                put_people(dictionary, 0, 1000);
+
+                should_bool(dictionary->table.table_current_size <= dictionary->table.table_max_size / 2) be truthy;
+                should_int(dictionary_size(dictionary)) be equal to(1000);
+                assert_person(dictionary_get(dictionary, "500"), "500", 500 % 256);
+            } end
+
+        } end
+
+        describe ("Upsert") {
+
+            it("should insert the value built by the factory only once") {
+                int calls = 0;
+                void* _create_person(char* key) {
+                    calls++;
+                    return persona_create(key, 30);
+                }
+
+                t_person** first = (t_person**) dictionary_get_or_insert(dictionary, "Matias", _create_person);
+                assert_person(*first, "Matias", 30);
+                (*first)->age = 24;
+
+                t_person** second = (t_person**) dictionary_get_or_insert(dictionary, "Matias", _create_person);
+                assert_person(*second, "Matias", 24);
+
+                should_int(calls) be equal to(1);
+                should_int(dictionary_size(dictionary)) be equal to(1);
+            } end
+
+            it("should replace the value through the returned slot") {
+                t_person** slot = (t_person**) dictionary_get_or_insert(dictionary, "Matias", NULL);
+                should_ptr(*slot) be null;
+
+                *slot = persona_create("Matias", 24);
+
+                assert_person(dictionary_get(dictionary, "Matias"), "Matias", 24);
+            } end
+
+            it("should count keys while the table grows") {
+                t_dictionary* counts = dictionary_create();
+                for (int i = 0; i < 3000; i++) {
+                    char* key = string_itoa(i % 1000);
+                    void** count = dictionary_get_or_insert(counts, key, NULL);
+                    *count = (void*) ((intptr_t) *count + 1);
+                    free(key);
+                }
+
+                should_int(dictionary_size(counts)) be equal to(1000);
+                should_int((intptr_t) dictionary_get(counts, "0")) be equal to(3);
+                should_int((intptr_t) dictionary_get(counts, "999")) be equal to(3);
+
+                dictionary_destroy(counts);
+            } end
+
+            it("should compute a new value from the current one") {
+                void* _birthday(char* key, t_person* person) {
+                    if (person == NULL) {
+                        return persona_create(key, 0);
+                    }
+                    person->age++;
+                    return person;
+                }
+
+                dictionary_compute(dictionary, "Matias", (void*) _birthday);
+                t_person* matias = dictionary_compute(dictionary, "Matias", (void*) _birthday);
+
+                assert_person(matias, "Matias", 1);
+                should_ptr(dictionary_get(dictionary, "Matias")) be equal to(matias);
+            } end
+
+            it("should remove the key when the computed value is null") {
+                dictionary_put(dictionary, "Matias", persona_create("Matias", 24));
+
+                void* _retire(char* key, t_person* person) {
+                    if (person != NULL) {
+                        persona_destroy(person);
+                    }
+                    return NULL;
+                }
+
+                should_ptr(dictionary_compute(dictionary, "Matias", (void*) _retire)) be null;
+                should_ptr(dictionary_compute(dictionary, "Gaston", (void*) _retire)) be null;
+                should_bool(dictionary_has_key(dictionary, "Matias")) be falsey;
+                should_bool(dictionary_is_empty(dictionary)) be truthy;
+            } end
+
+            it("should use only the given length of the key") {
+                char* line = "Matias=24";
+                void* _create_gaston(char* key) {
+                    return persona_create(key, 25);
+                }
+
+                dictionary_put_with_length(dictionary, line, 6, persona_create("Matias", 24));
+                dictionary_get_or_insert_with_length(dictionary, "Gaston,Matias", 6, _create_gaston);
+
+                assert_person(dictionary_get(dictionary, "Matias"), "Matias", 24);
+                assert_person(dictionary_get_with_length(dictionary, "Gastonazo", 6), "Gaston", 25);
+                should_ptr(dictionary_get_with_length(dictionary, "Mati", 4)) be null;
+                should_ptr(dictionary_get_with_length(dictionary, "Matias", 7)) be null;
+                should_int(dictionary_size(dictionary)) be equal to(2);
+            } end
+
+        } end
+
+        describe ("Hash seed") {
+
+            it("should use a different seed for each dictionary") {
+                t_dictionary* other = dictionary_create();
+
+                should_bool(other->seed != dictionary->seed) be truthy;
+
+                dictionary_destroy(other);
+            } end
+
+            it("should spread the keys that collide under another seed") {
+                // Claves elegidas para que caigan en el mismo grupo de una
+                // tabla de 1024 posiciones cuando la semilla es conocida
+                t_dictionary* known_seed = dictionary_create_with_seed(42);
+                t_list* attack = list_create();
+                for (int i = 0; attack->elements_count < 100; i++) {
+                    char* key = string_from_format("file-%d.txt", i);
+                    dictionary_put(known_seed, key, NULL);
+                    if (home_group(hashcode_of(known_seed, key)) == 0) {
+                        list_add(attack, key);
+                    } else {
+                        free(key);
+                    }
+                }
+
+                t_dictionary* random_seed = dictionary_create();
+                int groups[64] = {0};
+                void _put_attack_key(char* key) {
+                    dictionary_put(random_seed, key, NULL);
+                    groups[home_group(hashcode_of(random_seed, key))]++;
+                }
+                list_iterate(attack, (void*) _put_attack_key);
+
+                int largest_group = 0;
+                for (int i = 0; i < 64; i++) {
+                    largest_group = groups[i] > largest_group ? groups[i] : largest_group;
+                }
+                should_int(dictionary_size(random_seed)) be equal to(100);
+                should_bool(largest_group < 16) be truthy;
+
+                list_destroy_and_destroy_elements(attack, free);
+                dictionary_destroy(random_seed);
+                dictionary_destroy(known_seed);
+            } end
+
+            it("should distribute the keys the same way for the same seed") {
+                t_dictionary* first = dictionary_create_with_seed(42);
+                t_dictionary* second = dictionary_create_with_seed(42);
+                dictionary_put(first, "Matias", NULL);
+                dictionary_put(second, "Matias", NULL);
+
+                should_int(hashcode_of(first, "Matias")) be equal to(hashcode_of(second, "Matias"));
+
+                dictionary_destroy(first);
+                dictionary_destroy(second);
+            } end
+
+        } end
+
         describe ("Iterate") {
 
             int iterator_count;
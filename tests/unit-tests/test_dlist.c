@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <commons/collections/dlist.h>
+#include <cspecs/cspec.h>
+
+static intptr_t visited[16];
+static int visited_count;
+
+static void visit(void *data) {
+    visited[visited_count++] = (intptr_t) data;
+}
+
+context (test_dlist) {
+
+    void assert_visited(intptr_t first, intptr_t second, intptr_t third) {
+        should_int(visited_count) be equal to(3);
+        should_int(visited[0]) be equal to(first);
+        should_int(visited[1]) be equal to(second);
+        should_int(visited[2]) be equal to(third);
+    }
+
+    describe ("Double linked list") {
+
+        t_dlist *list;
+
+        before {
+            list = dlist_create();
+            visited_count = 0;
+        } end
+
+        after {
+            dlist_destroy(list);
+        } end
+
+        it ("should be empty after creation") {
+            should_bool(dlist_is_empty(list)) be truthy;
+            should_ptr(dlist_get_first(list)) be null;
+            should_ptr(dlist_get_last(list)) be null;
+            should_ptr(dlist_remove_first(list)) be null;
+            should_ptr(dlist_remove_last(list)) be null;
+        } end
+
+        it ("should add elements at both ends") {
+            dlist_add_last(list, (void*) 2);
+            dlist_add_first(list, (void*) 1);
+            dlist_add_last(list, (void*) 3);
+
+            should_int(dlist_size(list)) be equal to(3);
+            should_int((intptr_t) dlist_get_first(list)) be equal to(1);
+            should_int((intptr_t) dlist_get_last(list)) be equal to(3);
+            dlist_iterate(list, visit);
+            assert_visited(1, 2, 3);
+        } end
+
+        it ("should iterate in reverse order") {
+            dlist_add_last(list, (void*) 1);
+            dlist_add_last(list, (void*) 2);
+            dlist_add_last(list, (void*) 3);
+
+            dlist_iterate_reverse(list, visit);
+            assert_visited(3, 2, 1);
+        } end
+
+        it ("should remove elements from both ends") {
+            dlist_add_last(list, (void*) 1);
+            dlist_add_last(list, (void*) 2);
+            dlist_add_last(list, (void*) 3);
+
+            should_int((intptr_t) dlist_remove_last(list)) be equal to(3);
+            should_int((intptr_t) dlist_remove_first(list)) be equal to(1);
+            should_int((intptr_t) dlist_remove_last(list)) be equal to(2);
+            should_bool(dlist_is_empty(list)) be truthy;
+            should_ptr(list->head) be null;
+            should_ptr(list->tail) be null;
+        } end
+
+        it ("should remove an element through its node") {
+            t_double_link_element *first = dlist_add_last(list, (void*) 1);
+            t_double_link_element *middle = dlist_add_last(list, (void*) 2);
+            t_double_link_element *last = dlist_add_last(list, (void*) 3);
+            dlist_add_last(list, (void*) 4);
+
+            should_int((intptr_t) dlist_remove_node(list, middle)) be equal to(2);
+            should_int((intptr_t) dlist_remove_node(list, first)) be equal to(1);
+            dlist_remove_node(list, list->tail);
+            should_int((intptr_t) dlist_get_first(list)) be equal to(3);
+            should_int((intptr_t) dlist_get_last(list)) be equal to(3);
+            should_ptr(last->previous) be null;
+            should_ptr(last->next) be null;
+        } end
+
+        it ("should add elements next to a node") {
+            t_double_link_element *middle = dlist_add_last(list, (void*) 2);
+            dlist_add_before(list, middle, (void*) 1);
+            dlist_add_after(list, middle, (void*) 3);
+
+            dlist_iterate(list, visit);
+            assert_visited(1, 2, 3);
+            should_int((intptr_t) dlist_get_last(list)) be equal to(3);
+        } end
+
+        it ("should move a node to either end keeping the other nodes valid") {
+            t_double_link_element *first = dlist_add_last(list, (void*) 1);
+            t_double_link_element *middle = dlist_add_last(list, (void*) 2);
+            dlist_add_last(list, (void*) 3);
+
+            dlist_move_to_first(list, middle);
+            dlist_iterate(list, visit);
+            assert_visited(2, 1, 3);
+
+            visited_count = 0;
+            dlist_move_to_last(list, first);
+            dlist_iterate_reverse(list, visit);
+            assert_visited(1, 3, 2);
+            should_int(dlist_size(list)) be equal to(3);
+        } end
+
+        it ("should destroy the remaining elements") {
+            t_dlist *owned = dlist_create();
+            dlist_add_last(owned, malloc(sizeof(int)));
+            dlist_add_first(owned, malloc(sizeof(int)));
+            dlist_destroy_and_destroy_elements(owned, free);
+        } end
+
+    } end
+
+}
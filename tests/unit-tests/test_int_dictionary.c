@@ -0,0 +1,188 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <commons/collections/int_dictionary.h>
+#include <cspecs/cspec.h>
+
+typedef struct {
+    int pid;
+    char *name;
+} t_process;
+
+static t_process *process_create(int pid, char *name) {
+    t_process *new = malloc(sizeof(t_process));
+    new->pid = pid;
+    new->name = strdup(name);
+    return new;
+}
+
+static void process_destroy(t_process *self) {
+    free(self->name);
+    free(self);
+}
+
+context (test_int_dictionary) {
+
+    void assert_process(t_process *process, int pid, char* name) {
+        should_ptr(process) not be null;
+        should_int(process->pid) be equal to(pid);
+        should_string(process->name) be equal to(name);
+    }
+
+    describe ("Int dictionary") {
+
+        t_int_dictionary *dictionary;
+
+        before {
+            dictionary = int_dictionary_create();
+        } end
+
+        after {
+            int_dictionary_destroy_and_destroy_elements(dictionary, (void*) process_destroy);
+        } end
+
+        describe ("Put and get") {
+
+            it("should put a value") {
+                int_dictionary_put(dictionary, 1, process_create(1, "init"));
+                int_dictionary_put(dictionary, 42, process_create(42, "shell"));
+
+                should_int(int_dictionary_size(dictionary)) be equal to(2);
+                assert_process(int_dictionary_get(dictionary, 1), 1, "init");
+                assert_process(int_dictionary_get(dictionary, 42), 42, "shell");
+                should_ptr(int_dictionary_get(dictionary, 7)) be null;
+            } end
+
+            it("should update the value of an existing key") {
+                int_dictionary_put(dictionary, 42, process_create(42, "shell"));
+
+                t_process* old = int_dictionary_get(dictionary, 42);
+                int_dictionary_put(dictionary, 42, process_create(42, "editor"));
+                process_destroy(old);
+
+                should_int(int_dictionary_size(dictionary)) be equal to(1);
+                assert_process(int_dictionary_get(dictionary, 42), 42, "editor");
+            } end
+
+            it("should accept the whole range of keys") {
+                int_dictionary_put(dictionary, 0, process_create(0, "zero"));
+                int_dictionary_put(dictionary, UINT64_MAX, process_create(-1, "max"));
+
+                assert_process(int_dictionary_get(dictionary, 0), 0, "zero");
+                assert_process(int_dictionary_get(dictionary, UINT64_MAX), -1, "max");
+                should_bool(int_dictionary_has_key(dictionary, 1)) be falsey;
+            } end
+
+            it("should grow keeping every value") {
+                for (int pid = 0; pid < 5000; pid++) {
+                    int_dictionary_put(dictionary, pid, process_create(pid, "worker"));
+                }
+
+                should_int(int_dictionary_size(dictionary)) be equal to(5000);
+                for (int pid = 0; pid < 5000; pid++) {
+                    assert_process(int_dictionary_get(dictionary, pid), pid, "worker");
+                }
+            } end
+
+            it("should not resize while the given capacity is not exceeded") {
+                t_int_dictionary* presized = int_dictionary_create_with_capacity(1000);
+                int table_max_size = presized->table_max_size;
+
+                for (int page = 0; page < 1000; page++) {
+                    int_dictionary_put(presized, page, NULL);
+                }
+
+                should_int(presized->table_max_size) be equal to(table_max_size);
+                int_dictionary_destroy(presized);
+            } end
+
+        } end
+
+        describe ("Remove, destroy and clean") {
+
+            before {
+                for (int pid = 0; pid < 1000; pid++) {
+                    int_dictionary_put(dictionary, pid * 4096, process_create(pid, "worker"));
+                }
+            } end
+
+            it("should remove a value") {
+                t_process* process = int_dictionary_remove(dictionary, 10 * 4096);
+
+                assert_process(process, 10, "worker");
+                should_int(int_dictionary_size(dictionary)) be equal to(999);
+                should_bool(int_dictionary_has_key(dictionary, 10 * 4096)) be falsey;
+                should_ptr(int_dictionary_remove(dictionary, 10 * 4096)) be null;
+
+                process_destroy(process);
+            } end
+
+            it("should find the remaining keys after removing half of them") {
+                for (int pid = 0; pid < 1000; pid += 2) {
+                    int_dictionary_remove_and_destroy(dictionary, pid * 4096, (void*) process_destroy);
+                }
+
+                should_int(int_dictionary_size(dictionary)) be equal to(500);
+                for (int pid = 0; pid < 1000; pid++) {
+                    should_bool(int_dictionary_has_key(dictionary, pid * 4096)) be equal to(pid % 2 == 1);
+                }
+            } end
+
+            it("should clean and destroy all values") {
+                int_dictionary_clean_and_destroy_elements(dictionary, (void*) process_destroy);
+
+                should_bool(int_dictionary_is_empty(dictionary)) be truthy;
+                should_ptr(int_dictionary_get(dictionary, 0)) be null;
+            } end
+
+        } end
+
+        describe ("Iterate") {
+
+            it("should iterate all entries") {
+                int_dictionary_put(dictionary, 1, process_create(1, "init"));
+                int_dictionary_put(dictionary, 42, process_create(42, "shell"));
+                int_dictionary_put(dictionary, 100, process_create(100, "editor"));
+
+                int count = 0;
+                uint64_t key_sum = 0;
+                void _count(uint64_t key, t_process* process) {
+                    should_int(process->pid) be equal to(key);
+                    key_sum += key;
+                    count++;
+                }
+                int_dictionary_iterator(dictionary, (void*) _count);
+
+                should_int(count) be equal to(3);
+                should_int(key_sum) be equal to(143);
+            } end
+
+            it("should get all elements") {
+                int_dictionary_put(dictionary, 1, process_create(1, "init"));
+                int_dictionary_put(dictionary, 42, process_create(42, "shell"));
+
+                t_list* elements = int_dictionary_elements(dictionary);
+                should_int(list_size(elements)) be equal to(2);
+                list_destroy(elements);
+            } end
+
+        } end
+
+    } end
+
+}
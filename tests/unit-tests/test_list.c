@@ -21,6 +21,8 @@
 #include <stdint.h>
 #include <commons/collections/list.h>
 #include <commons/string.h>
+#include <commons/threadpool.h>
+#include <commons/collections/stream.h>
 #include <cspecs/cspec.h>
 
 typedef struct {
@@ -56,6 +58,75 @@ static void* _ayudantes_maximo_edad(t_person* person1, t_person* person2) {
     return person1->age >= person2->age ? person1 : person2;
 }
 
+static void* _doble(void* number) {
+    return (void*) ((intptr_t) number * 2);
+}
+
+static bool _es_par(void* number) {
+    return (intptr_t) number % 2 == 0;
+}
+
+static void* _sumar(void* number1, void* number2) {
+    return (void*) ((intptr_t) number1 + (intptr_t) number2);
+}
+
+static void* _concatenar_digito(void* digits, void* digit) {
+    return (void*) ((intptr_t) digits * 10 + (intptr_t) digit);
+}
+
+static bool _menor_o_igual(void* number1, void* number2) {
+    return (intptr_t) number1 <= (intptr_t) number2;
+}
+
+static bool _es_multiplo_de_tres(void* number) {
+    return (intptr_t) number % 3 == 0;
+}
+
+static bool _contiene_rango(t_list *list, intptr_t first, intptr_t last) {
+    bool contains = list_size(list) == last - first + 1;
+    for (intptr_t i = 0; contains && i < list_size(list); i++) {
+        contains = (intptr_t) list_get(list, i) == first + i;
+    }
+    return contains;
+}
+
+static bool _coincide_con_arreglo(t_list *list, intptr_t *numbers, int count) {
+    bool matches = list_size(list) == count;
+    for (int i = 0; matches && i < count; i++) {
+        matches = (intptr_t) list_get(list, i) == numbers[i];
+    }
+    return matches;
+}
+
+static void _operar_al_azar(t_list *list, intptr_t *numbers, int *count, int operation, int index, intptr_t value) {
+    // Aplica la misma operación a la lista y al arreglo de referencia
+    switch (operation) {
+    case 0:
+        list_add_in_index(list, index, (void*) value);
+        memmove(numbers + index + 1, numbers + index, (*count - index) * sizeof(intptr_t));
+        numbers[index] = value;
+        (*count)++;
+        break;
+    case 1:
+        if (index < *count) {
+            list_remove(list, index);
+            memmove(numbers + index, numbers + index + 1, (*count - index - 1) * sizeof(intptr_t));
+            (*count)--;
+        }
+        break;
+    case 2:
+        if (index < *count) {
+            list_replace(list, index, (void*) value);
+            numbers[index] = value;
+        }
+        break;
+    default:
+        list_add(list, (void*) value);
+        numbers[(*count)++] = value;
+        break;
+    }
+}
+
 context (test_list) {
 
     void assert_person(t_person *person, char* name, int age) {
@@ -167,6 +238,42 @@ context (test_list) {
                 list_destroy(other);
             } end
 
+            it("should add a value at the end after removing the last one") {
+                list_add(list, persona_create("Matias", 24));
+                list_add(list, persona_create("Gaston", 25));
+
+                persona_destroy(list_remove(list, 1));
+                list_add(list, persona_create("Sebastian", 21));
+
+                should_int(list_size(list)) be equal to(2);
+                assert_person_in_list(list, 0, "Matias"   , 24);
+                assert_person_in_list(list, 1, "Sebastian", 21);
+            } end
+
+            it("should add a value at the end after cleaning the list") {
+                list_add(list, persona_create("Matias", 24));
+                list_add(list, persona_create("Gaston", 25));
+
+                list_clean_and_destroy_elements(list, (void*) persona_destroy);
+                list_add(list, persona_create("Sebastian", 21));
+                list_add(list, persona_create("Daniela"  , 19));
+
+                should_int(list_size(list)) be equal to(2);
+                assert_person_in_list(list, 0, "Sebastian", 21);
+                assert_person_in_list(list, 1, "Daniela"  , 19);
+            } end
+
+            it("should add a value at the end after adding at last index") {
+                list_add(list, persona_create("Matias", 24));
+                list_add_in_index(list, 1, persona_create("Gaston", 25));
+                list_add(list, persona_create("Sebastian", 21));
+
+                should_int(list_size(list)) be equal to(3);
+                assert_person_in_list(list, 0, "Matias"   , 24);
+                assert_person_in_list(list, 1, "Gaston"   , 25);
+                assert_person_in_list(list, 2, "Sebastian", 21);
+            } end
+
         } end
 
         describe ("Duplicate") {
@@ -583,6 +690,23 @@ context (test_list) {
                 list_destroy_and_destroy_elements(sublist, (void*)persona_destroy);
             } end
 
+            it("should keep adding values at the end of both lists after removing the last \"N\" elements") {
+                t_list* sublist = list_slice_and_remove(list, 3, 2);
+
+                list_add(list, persona_create("Daniela", 19));
+                list_add(sublist, persona_create("Agustin", 23));
+
+                should_int(list_size(list)) be equal to(4);
+                assert_person_in_list(list, 3, "Daniela", 19);
+
+                should_int(list_size(sublist)) be equal to(3);
+                assert_person_in_list(sublist, 0, "Ezequiel", 25);
+                assert_person_in_list(sublist, 1, "Facundo" , 25);
+                assert_person_in_list(sublist, 2, "Agustin" , 23);
+
+                list_destroy_and_destroy_elements(sublist, (void*)persona_destroy);
+            } end
+
         } end
 
 
@@ -643,6 +767,31 @@ context (test_list) {
                         _verify_a_sort_with_duplicates(__sorted_list);
                     } end
 
+                    it("should keep the relative order of duplicated values") {
+                        list_add(list, persona_create("Ezequiel", 24));
+                        list_add(list, persona_create("Agustin" , 21));
+                        list_add(list, persona_create("Facundo" , 24));
+                        list_sort(list, (void*) _ayudantes_menor);
+
+                        should_int(list_size(list)) be equal to(7);
+                        assert_person_in_list(list, 0, "Daniela"  , 19);
+                        assert_person_in_list(list, 1, "Sebastian", 21);
+                        assert_person_in_list(list, 2, "Agustin"  , 21);
+                        assert_person_in_list(list, 3, "Matias"   , 24);
+                        assert_person_in_list(list, 4, "Ezequiel" , 24);
+                        assert_person_in_list(list, 5, "Facundo"  , 24);
+                        assert_person_in_list(list, 6, "Gaston"   , 25);
+                    } end
+
+                    it("should add a value at the end of a sorted list") {
+                        list_sort(list, (void*) _ayudantes_menor);
+                        list_add(list, persona_create("Ezequiel", 25));
+
+                        should_int(list_size(list)) be equal to(5);
+                        assert_person_in_list(list, 3, "Gaston"  , 25);
+                        assert_person_in_list(list, 4, "Ezequiel", 25);
+                    } end
+
                 } end
 
                 describe ("Sorted - without side effect") {
@@ -673,6 +822,33 @@ context (test_list) {
         } end
 
 
+        describe ("Sort a big list") {
+
+            bool _int_less_or_equal(void* a, void* b) {
+                return (intptr_t) a <= (intptr_t) b;
+            }
+
+            it("should sort a list with an odd amount of unsorted values") {
+                t_list* numbers = list_create();
+                for (int i = 0; i < 1001; i++) {
+                    list_add(numbers, (void*) (intptr_t) ((i * 7919) % 1001));
+                }
+
+                list_sort(numbers, _int_less_or_equal);
+
+                should_int(list_size(numbers)) be equal to(1001);
+                for (int i = 0; i < 1001; i++) {
+                    should_int((intptr_t) list_get(numbers, i)) be equal to(i);
+                }
+
+                list_add(numbers, (void*) (intptr_t) 1001);
+                should_int((intptr_t) list_get(numbers, 1001)) be equal to(1001);
+
+                list_destroy(numbers);
+            } end
+
+        } end
+
         describe ("Satisfying") {
 
             bool _ayudante_menor_o_igual_a_21(void *ayudante) {
@@ -953,6 +1129,347 @@ context (test_list) {
                 assert_person_in_list(list, 1, "Gaston"   , 25);
                 assert_person_in_list(list, 2, "Sebastian", 21);
             } end
+
+            it("Should add a value at the end after removing last element") {
+                _remove_all_by_name("Daniela");
+                list_add(list, persona_create("Agustin", 23));
+
+                should_int(list->elements_count) be equal to (4);
+                assert_person_in_list(list, 2, "Sebastian", 21);
+                assert_person_in_list(list, 3, "Agustin"  , 23);
+            } end
+        } end
+
+    } end
+
+    describe ("Parallel operations") {
+
+        t_threadpool *threads;
+        t_list *numbers;
+
+        before {
+            threads = threadpool_create(4);
+            numbers = list_create();
+            for (intptr_t i = 0; i < 100000; i++) {
+                list_add(numbers, (void*) i);
+            }
+        } end
+
+        after {
+            list_destroy(numbers);
+            threadpool_destroy(threads);
+        } end
+
+        it ("should map every element keeping the order") {
+            t_list *doubled = list_parallel_map(numbers, threads, _doble);
+
+            should_int(list_size(doubled)) be equal to(100000);
+            t_list_iterator *iterator = list_iterator_create(doubled);
+            bool in_order = true;
+            while (list_iterator_has_next(iterator)) {
+                int index = list_iterator_index(iterator) + 1;
+                in_order = in_order && (intptr_t) list_iterator_next(iterator) == index * 2;
+            }
+            list_iterator_destroy(iterator);
+            should_bool(in_order) be truthy;
+
+            list_add(doubled, (void*) 1);
+            should_int((intptr_t) list_get(doubled, 100000)) be equal to(1);
+            list_destroy(doubled);
+        } end
+
+        it ("should filter the elements keeping the order") {
+            t_list *even = list_parallel_filter(numbers, threads, _es_par);
+
+            should_int(list_size(even)) be equal to(50000);
+            should_int((intptr_t) list_get(even, 0)) be equal to(0);
+            should_int((intptr_t) list_get(even, 12345)) be equal to(24690);
+            should_int((intptr_t) list_get(even, 49999)) be equal to(99998);
+            list_destroy(even);
+        } end
+
+        it ("should fold every element with an associative operation") {
+            intptr_t sum = (intptr_t) list_parallel_fold(numbers, threads, (void*) 7, _sumar);
+            should_int(sum) be equal to(7 + (intptr_t) 100000 * 99999 / 2);
+        } end
+
+        it ("should combine the partial folds in order") {
+            t_list *digits = list_create();
+            for (intptr_t i = 1; i <= 9; i++) {
+                list_add(digits, (void*) i);
+            }
+            should_int((intptr_t) list_parallel_fold(digits, threads, 0, _concatenar_digito)) be equal to(123456789);
+            list_destroy(digits);
+        } end
+
+        it ("should return the seed when folding an empty list") {
+            t_list *empty = list_create();
+            should_int((intptr_t) list_parallel_fold(empty, threads, (void*) 7, _sumar)) be equal to(7);
+
+            t_list *mapped = list_parallel_map(empty, threads, _doble);
+            should_bool(list_is_empty(mapped)) be truthy;
+            list_destroy(mapped);
+            list_destroy(empty);
+        } end
+
+        it ("should build the result with the node pool of the original list") {
+            t_node_pool *pool = node_pool_create(sizeof(t_link_element), DEFAULT_NODE_POOL_SLAB_SIZE);
+            t_list *pooled = list_create_with_pool(pool);
+            list_add_all(pooled, numbers);
+
+            t_list *even = list_parallel_filter(pooled, threads, _es_par);
+            should_int(list_size(even)) be equal to(50000);
+            should_int(node_pool_get_stats(pool).nodes_in_use) be equal to(150000);
+
+            list_destroy(even);
+            list_destroy(pooled);
+            node_pool_destroy(pool);
+        } end
+
+    } end
+
+    describe ("Unrolled list") {
+
+        t_list *numbers;
+
+        before {
+            numbers = list_create_unrolled();
+            for (intptr_t i = 0; i < 100; i++) {
+                list_add(numbers, (void*) i);
+            }
+        } end
+
+        after {
+            list_destroy(numbers);
+        } end
+
+        it ("should add and get elements across several nodes") {
+            should_int(list_size(numbers)) be equal to(100);
+            should_bool(_contiene_rango(numbers, 0, 99)) be truthy;
+            should_ptr(numbers->head) be null;
+            should_ptr(numbers->unrolled_head->next) not be null;
+        } end
+
+        it ("should add elements in the middle splitting full nodes") {
+            for (intptr_t i = 0; i < 100; i++) {
+                list_add_in_index(numbers, 50, (void*) (1000 + i));
+            }
+
+            should_int(list_size(numbers)) be equal to(200);
+            should_int((intptr_t) list_get(numbers, 49)) be equal to(49);
+            should_int((intptr_t) list_get(numbers, 50)) be equal to(1099);
+            should_int((intptr_t) list_get(numbers, 149)) be equal to(1000);
+            should_int((intptr_t) list_get(numbers, 150)) be equal to(50);
+            should_int((intptr_t) list_get(numbers, 199)) be equal to(99);
+
+            list_add_in_index(numbers, 0, (void*) -1);
+            list_add_in_index(numbers, 201, (void*) 100);
+            should_int((intptr_t) list_get(numbers, 0)) be equal to(-1);
+            should_int((intptr_t) list_get(numbers, 201)) be equal to(100);
+        } end
+
+        it ("should remove and replace elements merging almost empty nodes") {
+            for (intptr_t i = 0; i < 90; i++) {
+                should_int((intptr_t) list_remove(numbers, 5)) be equal to(5 + i);
+            }
+            should_int(list_size(numbers)) be equal to(10);
+            should_int((intptr_t) list_get(numbers, 4)) be equal to(4);
+            should_int((intptr_t) list_get(numbers, 5)) be equal to(95);
+            should_ptr(numbers->unrolled_head->next) be null;
+
+            should_int((intptr_t) list_replace(numbers, 9, (void*) 7)) be equal to(99);
+            should_int((intptr_t) list_remove_by_condition(numbers, _es_par)) be equal to(0);
+            list_remove_and_destroy_all_by_condition(numbers, _es_par, (void*) _es_par);
+            should_int(list_size(numbers)) be equal to(5);
+            should_int((intptr_t) list_get(numbers, 4)) be equal to(7);
+        } end
+
+        it ("should add and remove elements through an iterator") {
+            t_list_iterator *iterator = list_iterator_create(numbers);
+            while (list_iterator_has_next(iterator)) {
+                intptr_t number = (intptr_t) list_iterator_next(iterator);
+                if (_es_par((void*) number)) {
+                    list_iterator_remove(iterator);
+                } else {
+                    list_iterator_add(iterator, (void*) -number);
+                }
+            }
+            list_iterator_destroy(iterator);
+
+            should_int(list_size(numbers)) be equal to(100);
+            should_int((intptr_t) list_get(numbers, 0)) be equal to(1);
+            should_int((intptr_t) list_get(numbers, 1)) be equal to(-1);
+            should_int((intptr_t) list_get(numbers, 98)) be equal to(99);
+            should_int((intptr_t) list_get(numbers, 99)) be equal to(-99);
+        } end
+
+        it ("should slice, take and remove ranges") {
+            t_list *slice = list_slice(numbers, 30, 40);
+            should_bool(slice->unrolled) be truthy;
+            should_bool(_contiene_rango(slice, 30, 69)) be truthy;
+            list_destroy(slice);
+
+            t_list *removed = list_slice_and_remove(numbers, 30, 40);
+            should_bool(_contiene_rango(removed, 30, 69)) be truthy;
+            should_int(list_size(numbers)) be equal to(60);
+            should_int((intptr_t) list_get(numbers, 30)) be equal to(70);
+            list_destroy(removed);
+
+            t_list *past_the_end = list_slice(numbers, 55, 10);
+            should_int(list_size(past_the_end)) be equal to(5);
+            list_destroy(past_the_end);
+        } end
+
+        it ("should sort keeping the order of equal elements") {
+            t_list *people = list_create_unrolled();
+            for (int i = 0; i < 100; i++) {
+                char *name = string_itoa(i);
+                list_add(people, persona_create(name, 100 - i % 10));
+                free(name);
+            }
+
+            list_sort(people, (void*) _ayudantes_menor);
+
+            bool sorted = true;
+            for (int i = 1; i < list_size(people); i++) {
+                t_person *previous = list_get(people, i - 1);
+                t_person *current = list_get(people, i);
+                sorted = sorted && (previous->age < current->age
+                        || (previous->age == current->age && atoi(previous->name) < atoi(current->name)));
+            }
+            should_bool(sorted) be truthy;
+            list_destroy_and_destroy_elements(people, (void*) persona_destroy);
+        } end
+
+        it ("should add elements sorted") {
+            t_list *sorted = list_create_unrolled();
+            for (intptr_t i = 0; i < 100; i++) {
+                list_add_sorted(sorted, (void*) ((i * 37) % 100), _menor_o_igual);
+            }
+            should_bool(_contiene_rango(sorted, 0, 99)) be truthy;
+            should_int(list_add_sorted(sorted, (void*) 50, _menor_o_igual)) be equal to(51);
+            list_destroy(sorted);
+        } end
+
+        it ("should filter, map and fold like a linked list") {
+            t_list *even = list_filter(numbers, _es_par);
+            t_list *doubled = list_map(even, _doble);
+
+            should_bool(doubled->unrolled) be truthy;
+            should_int(list_size(doubled)) be equal to(50);
+            should_int((intptr_t) list_get(doubled, 49)) be equal to(196);
+            should_int((intptr_t) list_fold(numbers, 0, _sumar)) be equal to(4950);
+            should_int((intptr_t) list_fold1(numbers, _sumar)) be equal to(4950);
+            should_int((intptr_t) list_find(numbers, _es_multiplo_de_tres)) be equal to(0);
+
+            list_destroy(doubled);
+            list_destroy(even);
+        } end
+
+        it ("should run parallel operations and streams over the nodes") {
+            t_threadpool *threads = threadpool_create(4);
+            t_list *big = list_create_unrolled();
+            for (intptr_t i = 0; i < 100000; i++) {
+                list_add(big, (void*) i);
+            }
+
+            t_list *even = list_parallel_filter(big, threads, _es_par);
+            should_bool(even->unrolled) be truthy;
+            should_int(list_size(even)) be equal to(50000);
+            should_int((intptr_t) list_get(even, 49999)) be equal to(99998);
+            should_int((intptr_t) list_parallel_fold(big, threads, 0, _sumar)) be equal to((intptr_t) 100000 * 99999 / 2);
+
+            t_list *taken = stream_collect(stream_take(stream_filter(stream_of(big), _es_multiplo_de_tres), 4));
+            should_int(list_size(taken)) be equal to(4);
+            should_int((intptr_t) list_get(taken, 3)) be equal to(9);
+
+            list_destroy(taken);
+            list_destroy(even);
+            list_destroy(big);
+            threadpool_destroy(threads);
+        } end
+
+        it ("should clean every node") {
+            list_clean(numbers);
+            should_bool(list_is_empty(numbers)) be truthy;
+            should_ptr(numbers->unrolled_head) be null;
+            list_add(numbers, (void*) 1);
+            should_int((intptr_t) list_get(numbers, 0)) be equal to(1);
+        } end
+
+    } end
+
+    describe ("Cursor") {
+
+        t_list *numbers;
+
+        before {
+            numbers = list_create();
+            for (intptr_t i = 0; i < 100; i++) {
+                list_add(numbers, (void*) i);
+            }
+        } end
+
+        after {
+            list_destroy(numbers);
+        } end
+
+        it ("should get the elements in order and then go back") {
+            for (intptr_t i = 0; i < 100; i++) {
+                should_int((intptr_t) list_get(numbers, i)) be equal to(i);
+            }
+            should_int((intptr_t) list_get(numbers, 3)) be equal to(3);
+            should_int((intptr_t) list_get(numbers, 99)) be equal to(99);
+        } end
+
+        it ("should remove elements at the cursor while iterating by index") {
+            for (int i = 0; i < list_size(numbers); ) {
+                if (_es_par(list_get(numbers, i))) {
+                    list_remove(numbers, i);
+                } else {
+                    i++;
+                }
+            }
+            should_int(list_size(numbers)) be equal to(50);
+            should_int((intptr_t) list_get(numbers, 0)) be equal to(1);
+            should_int((intptr_t) list_get(numbers, 49)) be equal to(99);
+        } end
+
+        it ("should forget the cursor when an earlier element is removed") {
+            should_int((intptr_t) list_get(numbers, 50)) be equal to(50);
+            list_remove(numbers, 10);
+            should_int((intptr_t) list_get(numbers, 50)) be equal to(51);
+            list_remove_by_condition(numbers, _es_multiplo_de_tres);
+            should_int((intptr_t) list_get(numbers, 50)) be equal to(52);
+            list_add_in_index(numbers, 0, (void*) -1);
+            should_int((intptr_t) list_get(numbers, 50)) be equal to(51);
+            list_sort(numbers, _menor_o_igual);
+            should_int((intptr_t) list_get(numbers, 50)) be equal to(51);
+            list_clean(numbers);
+            list_add(numbers, (void*) 7);
+            should_int((intptr_t) list_get(numbers, 0)) be equal to(7);
+        } end
+
+        it ("should keep linked and unrolled lists consistent under random operations") {
+            t_list *lists[] = { list_create(), list_create_unrolled() };
+            for (int l = 0; l < 2; l++) {
+                intptr_t *expected = malloc(2000 * sizeof(intptr_t));
+                int count = 0;
+                srand(42);
+                bool consistent = true;
+                for (int i = 0; i < 1500 && consistent; i++) {
+                    int index = count > 0 ? rand() % (count + 1) : 0;
+                    _operar_al_azar(lists[l], expected, &count, rand() % 4, index, i);
+                    if (count > 0) {
+                        int near = (index + rand() % 5) % count;
+                        consistent = (intptr_t) list_get(lists[l], near) == expected[near];
+                    }
+                }
+                should_bool(consistent) be truthy;
+                should_bool(_coincide_con_arreglo(lists[l], expected, count)) be truthy;
+                free(expected);
+                list_destroy(lists[l]);
+            }
         } end
 
     } end
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <commons/collections/mpmc_queue.h>
+#include <cspecs/cspec.h>
+
+#define MPMC_THREADS 4
+#define MPMC_ELEMENTS_PER_THREAD 20000
+
+static t_mpmc_queue *shared_mpmc_queue;
+
+static void *push_range(void *first) {
+    for (intptr_t i = 0; i < MPMC_ELEMENTS_PER_THREAD; i++) {
+        mpmc_queue_push(shared_mpmc_queue, (void*) ((intptr_t) first + i));
+    }
+    return NULL;
+}
+
+static void *pop_and_sum(void *_) {
+    intptr_t sum = 0;
+    for (int i = 0; i < MPMC_ELEMENTS_PER_THREAD; i++) {
+        sum += (intptr_t) mpmc_queue_pop(shared_mpmc_queue);
+    }
+    return (void*) sum;
+}
+
+context (test_mpmc_queue) {
+
+    describe ("MPMC queue") {
+
+        t_mpmc_queue *queue;
+
+        before {
+            queue = mpmc_queue_create(4);
+        } end
+
+        after {
+            mpmc_queue_destroy(queue);
+        } end
+
+        it ("should pop the elements in the order they were pushed") {
+            void *element;
+
+            should_bool(mpmc_queue_try_push(queue, (void*) 1)) be truthy;
+            should_bool(mpmc_queue_try_push(queue, (void*) 2)) be truthy;
+            should_int(mpmc_queue_size(queue)) be equal to(2);
+
+            should_bool(mpmc_queue_try_pop(queue, &element)) be truthy;
+            should_int((intptr_t) element) be equal to(1);
+            should_bool(mpmc_queue_try_pop(queue, &element)) be truthy;
+            should_int((intptr_t) element) be equal to(2);
+            should_bool(mpmc_queue_try_pop(queue, &element)) be falsey;
+        } end
+
+        it ("should reject pushes when it is full and accept them again after a pop") {
+            void *element;
+            for (intptr_t i = 0; i < 4; i++) {
+                should_bool(mpmc_queue_try_push(queue, (void*) i)) be truthy;
+            }
+
+            should_bool(mpmc_queue_try_push(queue, (void*) 4)) be falsey;
+            mpmc_queue_try_pop(queue, &element);
+            should_bool(mpmc_queue_try_push(queue, (void*) 4)) be truthy;
+            should_int(mpmc_queue_size(queue)) be equal to(4);
+        } end
+
+        it ("should deliver every element once with several producers and consumers") {
+            pthread_t producers[MPMC_THREADS], consumers[MPMC_THREADS];
+            shared_mpmc_queue = queue;
+
+            for (intptr_t i = 0; i < MPMC_THREADS; i++) {
+                pthread_create(&consumers[i], NULL, pop_and_sum, NULL);
+                pthread_create(&producers[i], NULL, push_range, (void*) (i * MPMC_ELEMENTS_PER_THREAD));
+            }
+
+            intptr_t sum = 0;
+            for (int i = 0; i < MPMC_THREADS; i++) {
+                void *partial_sum;
+                pthread_join(producers[i], NULL);
+                pthread_join(consumers[i], &partial_sum);
+                sum += (intptr_t) partial_sum;
+            }
+
+            intptr_t total = MPMC_THREADS * MPMC_ELEMENTS_PER_THREAD;
+            should_int(sum) be equal to(total * (total - 1) / 2);
+            should_int(mpmc_queue_size(queue)) be equal to(0);
+        } end
+
+    } end
+
+}
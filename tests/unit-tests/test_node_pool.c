@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <commons/collections/node_pool.h>
+#include <commons/collections/list.h>
+#include <cspecs/cspec.h>
+
+context (test_node_pool) {
+
+    describe ("Node pool") {
+
+        t_node_pool *pool;
+
+        before {
+            pool = node_pool_create(sizeof(t_link_element), 4);
+        } end
+
+        after {
+            node_pool_destroy(pool);
+        } end
+
+        it ("should reserve a slab on the first allocation") {
+            void* node = node_pool_alloc(pool);
+
+            t_node_pool_stats stats = node_pool_get_stats(pool);
+            should_int(stats.slabs) be equal to(1);
+            should_int(stats.nodes_in_use) be equal to(1);
+            should_int(stats.nodes_available) be equal to(3);
+
+            node_pool_free(pool, node);
+        } end
+
+        it ("should reuse released nodes before reserving another slab") {
+            void* first = node_pool_alloc(pool);
+            node_pool_free(pool, first);
+            void* second = node_pool_alloc(pool);
+
+            should_ptr(second) be equal to(first);
+            should_int(node_pool_get_stats(pool).slabs) be equal to(1);
+
+            node_pool_free(pool, second);
+        } end
+
+        it ("should reserve another slab when there are no available nodes") {
+            void* nodes[5];
+            for (int i = 0; i < 5; i++) {
+                nodes[i] = node_pool_alloc(pool);
+            }
+
+            t_node_pool_stats stats = node_pool_get_stats(pool);
+            should_int(stats.slabs) be equal to(2);
+            should_int(stats.nodes_in_use) be equal to(5);
+            should_int(stats.nodes_available) be equal to(3);
+
+            for (int i = 0; i < 5; i++) {
+                node_pool_free(pool, nodes[i]);
+            }
+
+            stats = node_pool_get_stats(pool);
+            should_int(stats.nodes_in_use) be equal to(0);
+            should_int(stats.allocations) be equal to(5);
+            should_int(stats.releases) be equal to(5);
+        } end
+
+        it ("should reserve the requested nodes in a single slab") {
+            void* node = node_pool_alloc(pool);
+
+            node_pool_reserve(pool, 100);
+
+            t_node_pool_stats stats = node_pool_get_stats(pool);
+            should_int(stats.slabs) be equal to(2);
+            should_int(stats.nodes_available) be equal to(100);
+
+            node_pool_reserve(pool, 50);
+            should_int(node_pool_get_stats(pool).slabs) be equal to(2);
+
+            node_pool_free(pool, node);
+        } end
+
+        describe ("List with pool") {
+
+            t_list *list;
+
+            before {
+                list = list_create_with_pool(pool);
+                for (intptr_t i = 0; i < 10; i++) {
+                    list_add(list, (void*) i);
+                }
+            } end
+
+            after {
+                list_destroy(list);
+                should_int(node_pool_get_stats(pool).nodes_in_use) be equal to(0);
+            } end
+
+            it ("should take its nodes from the pool") {
+                should_int(node_pool_get_stats(pool).nodes_in_use) be equal to(10);
+
+                list_remove(list, 0);
+                list_remove(list, 0);
+
+                should_int(node_pool_get_stats(pool).nodes_in_use) be equal to(8);
+                should_int((intptr_t) list_get(list, 0)) be equal to(2);
+            } end
+
+            it ("should share the pool with the lists created from it") {
+                t_list* sublist = list_slice_and_remove(list, 2, 5);
+
+                should_ptr(sublist->pool) be equal to(pool);
+                should_int(node_pool_get_stats(pool).nodes_in_use) be equal to(10);
+
+                list_destroy(sublist);
+                should_int(node_pool_get_stats(pool).nodes_in_use) be equal to(5);
+            } end
+
+        } end
+
+    } end
+
+}
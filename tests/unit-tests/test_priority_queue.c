@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <commons/collections/priority_queue.h>
+#include <cspecs/cspec.h>
+
+typedef struct {
+    char *name;
+    int priority;
+} t_task;
+
+static t_task *task_create(char *name, int priority) {
+    t_task *new = malloc(sizeof(t_task));
+    new->name = name;
+    new->priority = priority;
+    return new;
+}
+
+static bool task_has_lower_priority_value(void *a, void *b) {
+    return ((t_task*) a)->priority <= ((t_task*) b)->priority;
+}
+
+context (test_priority_queue) {
+
+    describe ("Priority queue") {
+
+        t_priority_queue *queue;
+
+        before {
+            queue = priority_queue_create(task_has_lower_priority_value);
+        } end
+
+        after {
+            priority_queue_destroy_and_destroy_elements(queue, free);
+        } end
+
+        it ("should be empty after creation") {
+            should_bool(priority_queue_is_empty(queue)) be truthy;
+            should_int(priority_queue_size(queue)) be equal to(0);
+            should_ptr(priority_queue_peek(queue)) be null;
+            should_ptr(priority_queue_pop(queue)) be null;
+        } end
+
+        it ("should pop the elements ordered by the comparator") {
+            int priorities[] = { 5, 3, 9, 1, 7, 2, 8, 6, 4, 0 };
+            for (int i = 0; i < 10; i++) {
+                priority_queue_push(queue, task_create("task", priorities[i]));
+            }
+            should_int(priority_queue_size(queue)) be equal to(10);
+            should_int(((t_task*) priority_queue_peek(queue))->priority) be equal to(0);
+
+            for (int i = 0; i < 10; i++) {
+                t_task *task = priority_queue_pop(queue);
+                should_int(task->priority) be equal to(i);
+                free(task);
+            }
+            should_bool(priority_queue_is_empty(queue)) be truthy;
+        } end
+
+        it ("should keep the order after growing beyond its initial capacity") {
+            for (int i = 999; i >= 0; i--) {
+                priority_queue_push(queue, task_create("task", (i * 7) % 1000));
+            }
+
+            for (int i = 0; i < 1000; i++) {
+                t_task *task = priority_queue_pop(queue);
+                should_int(task->priority) be equal to(i);
+                free(task);
+            }
+        } end
+
+        it ("should move an element to the front when its priority is decreased") {
+            priority_queue_push(queue, task_create("Ayudante", 10));
+            int handle = priority_queue_push(queue, task_create("Matias", 30));
+            priority_queue_push(queue, task_create("Gaston", 20));
+
+            t_task *task = priority_queue_get(queue, handle);
+            should_string(task->name) be equal to("Matias");
+            task->priority = 5;
+            priority_queue_update(queue, handle);
+
+            should_string(((t_task*) priority_queue_peek(queue))->name) be equal to("Matias");
+        } end
+
+        it ("should move an element to the back when its priority is increased") {
+            int handle = priority_queue_push(queue, task_create("Ayudante", 10));
+            priority_queue_push(queue, task_create("Matias", 30));
+            priority_queue_push(queue, task_create("Gaston", 20));
+
+            ((t_task*) priority_queue_get(queue, handle))->priority = 40;
+            priority_queue_update(queue, handle);
+
+            t_task *task = priority_queue_pop(queue);
+            should_string(task->name) be equal to("Gaston");
+            free(task);
+            task = priority_queue_pop(queue);
+            should_string(task->name) be equal to("Matias");
+            free(task);
+            task = priority_queue_pop(queue);
+            should_string(task->name) be equal to("Ayudante");
+            free(task);
+        } end
+
+        it ("should remove an element by its handle") {
+            int handles[8];
+            for (int i = 0; i < 8; i++) {
+                handles[i] = priority_queue_push(queue, task_create("task", i));
+            }
+
+            t_task *removed = priority_queue_remove(queue, handles[3]);
+            should_int(removed->priority) be equal to(3);
+            free(removed);
+            should_int(priority_queue_size(queue)) be equal to(7);
+
+            for (int i = 0; i < 8; i++) {
+                if (i == 3) continue;
+                t_task *task = priority_queue_pop(queue);
+                should_int(task->priority) be equal to(i);
+                free(task);
+            }
+        } end
+
+        it ("should keep the handles of the remaining elements valid after removals") {
+            int first = priority_queue_push(queue, task_create("first", 1));
+            int second = priority_queue_push(queue, task_create("second", 2));
+            free(priority_queue_remove(queue, first));
+            int third = priority_queue_push(queue, task_create("third", 3));
+
+            should_string(((t_task*) priority_queue_get(queue, second))->name) be equal to("second");
+            should_string(((t_task*) priority_queue_get(queue, third))->name) be equal to("third");
+        } end
+
+    } end
+
+}
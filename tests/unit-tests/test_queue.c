@@ -18,6 +18,7 @@
 #include <stdio.h>
 #include <assert.h>
 #include <string.h>
+#include <stdint.h>
 #include <commons/collections/queue.h>
 #include <cspecs/cspec.h>
 
@@ -113,7 +114,103 @@ context (test_queue) {
 
         } end
 
+        describe ("Ring buffer") {
+
+            void pop_assert_and_destroy(t_queue *queue, char* name, int age) {
+                t_person *aux = queue_pop(queue);
+                assert_person(aux, name, age);
+                persona_destroy(aux);
+            }
+
+            it("should return null when popping an empty queue") {
+                should_ptr(queue_pop(queue)) be null;
+                should_ptr(queue_peek(queue)) be null;
+            } end
+
+            it("should keep the order when it wraps around and grows") {
+                t_queue* numbers = queue_create_with_capacity(4);
+                intptr_t pushed = 0, popped = 0;
+
+                for (int round = 0; round < 50; round++) {
+                    for (int i = 0; i < 3; i++) {
+                        queue_push(numbers, (void*) pushed++);
+                    }
+                    for (int i = 0; i < 2; i++) {
+                        should_int((intptr_t) queue_pop(numbers)) be equal to(popped++);
+                    }
+                }
+
+                should_int(queue_size(numbers)) be equal to(50);
+                should_bool(numbers->capacity >= 50) be truthy;
+                while (!queue_is_empty(numbers)) {
+                    should_int((intptr_t) queue_pop(numbers)) be equal to(popped++);
+                }
+                should_int(popped) be equal to(pushed);
+
+                queue_destroy(numbers);
+            } end
+
+            it("should push and pop elements in batches") {
+                queue_push(queue, persona_create("Matias", 24));
+                queue_push(queue, persona_create("Gaston", 25));
+                pop_assert_and_destroy(queue, "Matias", 24);
+
+                t_person* people[] = {
+                    persona_create("Sebastian", 21),
+                    persona_create("Daniela", 19),
+                    persona_create("Facundo", 25)
+                };
+                queue_push_batch(queue, (void**) people, 3);
+                should_int(queue_size(queue)) be equal to(4);
+
+                t_person* popped[10];
+                should_int(queue_pop_batch(queue, (void**) popped, 2)) be equal to(2);
+                assert_person(popped[0], "Gaston", 25);
+                assert_person(popped[1], "Sebastian", 21);
+                persona_destroy(popped[0]);
+                persona_destroy(popped[1]);
+
+                should_int(queue_pop_batch(queue, (void**) popped, 10)) be equal to(2);
+                assert_person(popped[0], "Daniela", 19);
+                assert_person(popped[1], "Facundo", 25);
+                persona_destroy(popped[0]);
+                persona_destroy(popped[1]);
+
+                should_bool(queue_is_empty(queue)) be truthy;
+            } end
+
+            it("should push a batch that wraps around the end of the buffer") {
+                t_queue* numbers = queue_create_with_capacity(8);
+                void* batch[6];
+                for (intptr_t i = 0; i < 6; i++) {
+                    queue_push(numbers, (void*) i);
+                    batch[i] = (void*) (i + 6);
+                }
+                for (intptr_t i = 0; i < 5; i++) {
+                    queue_pop(numbers);
+                }
+
+                queue_push_batch(numbers, batch, 6);
+
+                should_int(numbers->capacity) be equal to(8);
+                void* popped[7];
+                should_int(queue_pop_batch(numbers, popped, 7)) be equal to(7);
+                for (intptr_t i = 0; i < 7; i++) {
+                    should_int((intptr_t) popped[i]) be equal to(i + 5);
+                }
+
+                queue_destroy(numbers);
+            } end
+
+            it("should reserve capacity without adding elements") {
+                queue_reserve(queue, 100);
+
+                should_bool(queue->capacity >= 100) be truthy;
+                should_bool(queue_is_empty(queue)) be truthy;
+            } end
+
+        } end
+
     } end
 
 }
-
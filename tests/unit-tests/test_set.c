@@ -0,0 +1,243 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <commons/collections/set.h>
+#include <cspecs/cspec.h>
+
+static int visited_count;
+static uint64_t visited_sum;
+
+static void visit_string(char *element) {
+    visited_count++;
+    visited_sum += strlen(element);
+}
+
+static void visit_number(uint64_t element) {
+    visited_count++;
+    visited_sum += element;
+}
+
+static t_set *numbers_between(uint64_t from, uint64_t to, uint64_t step) {
+    t_set *set = set_create_int();
+    for (uint64_t number = from; number < to; number += step) {
+        set_add_int(set, number);
+    }
+    return set;
+}
+
+static bool contains_exactly_multiples(t_set *set, uint64_t limit, uint64_t first, uint64_t second, bool both) {
+    // Verifica que el conjunto tenga los números menores a limit que son
+    // múltiplos de first y/o de second
+    int expected = 0;
+    bool matches = true;
+    for (uint64_t number = 0; number < limit; number++) {
+        bool expected_in = both ? number % first == 0 && number % second == 0 : number % first == 0 || number % second == 0;
+        expected += expected_in ? 1 : 0;
+        matches = matches && set_contains_int(set, number) == expected_in;
+    }
+    return matches && set_size(set) == expected;
+}
+
+context (test_set) {
+
+    describe ("String set") {
+
+        t_set *set;
+
+        before {
+            set = set_create();
+            visited_count = 0;
+            visited_sum = 0;
+        } end
+
+        after {
+            set_destroy(set);
+        } end
+
+        it ("should be empty after creation") {
+            should_bool(set_is_empty(set)) be truthy;
+            should_bool(set_contains(set, "Matias")) be falsey;
+            should_bool(set_remove(set, "Matias")) be falsey;
+        } end
+
+        it ("should add copies of the strings without repeating them") {
+            char *name = strdup("Matias");
+            should_bool(set_add(set, name)) be truthy;
+            free(name);
+
+            should_bool(set_add(set, "Matias")) be falsey;
+            should_bool(set_add(set, "Gaston")) be truthy;
+            should_int(set_size(set)) be equal to(2);
+            should_bool(set_contains(set, "Matias")) be truthy;
+            should_bool(set_contains(set, "Mati")) be falsey;
+        } end
+
+        it ("should remove strings and iterate the remaining ones") {
+            char key[16];
+            for (int i = 0; i < 1000; i++) {
+                sprintf(key, "%d", i);
+                set_add(set, key);
+            }
+            for (int i = 0; i < 1000; i += 2) {
+                sprintf(key, "%d", i);
+                should_bool(set_remove(set, key)) be truthy;
+            }
+
+            should_int(set_size(set)) be equal to(500);
+            should_bool(set_contains(set, "999")) be truthy;
+            should_bool(set_contains(set, "998")) be falsey;
+            set_iterate(set, visit_string);
+            should_int(visited_count) be equal to(500);
+            should_int(visited_sum) be equal to(5 + 45 * 2 + 450 * 3);
+        } end
+
+        it ("should combine string sets") {
+            t_set *other = set_create();
+            set_add(set, "a");
+            set_add(set, "b");
+            set_add(set, "c");
+            set_add(other, "c");
+            set_add(other, "d");
+
+            t_set *both = set_union(set, other);
+            t_set *common = set_intersection(set, other);
+            t_set *only_mine = set_difference(set, other);
+
+            should_int(set_size(both)) be equal to(4);
+            should_bool(set_contains(both, "d")) be truthy;
+            should_int(set_size(common)) be equal to(1);
+            should_bool(set_contains(common, "c")) be truthy;
+            should_int(set_size(only_mine)) be equal to(2);
+            should_bool(set_contains(only_mine, "c")) be falsey;
+
+            set_destroy(both);
+            set_destroy(common);
+            set_destroy(only_mine);
+            set_destroy(other);
+        } end
+
+    } end
+
+    describe ("Integer set") {
+
+        t_set *set;
+
+        before {
+            set = set_create_int();
+            visited_count = 0;
+            visited_sum = 0;
+        } end
+
+        after {
+            set_destroy(set);
+        } end
+
+        it ("should add, find and remove integers and pointers") {
+            int value;
+            should_bool(set_add_int(set, 0)) be truthy;
+            should_bool(set_add_int(set, UINT64_MAX)) be truthy;
+            should_bool(set_add_int(set, (uintptr_t) &value)) be truthy;
+            should_bool(set_add_int(set, 0)) be falsey;
+
+            should_bool(set_contains_int(set, (uintptr_t) &value)) be truthy;
+            should_bool(set_remove_int(set, UINT64_MAX)) be truthy;
+            should_bool(set_contains_int(set, UINT64_MAX)) be falsey;
+            should_int(set_size(set)) be equal to(2);
+        } end
+
+        it ("should keep every element reachable after random adds and removes") {
+            bool present[5000] = { false };
+            bool consistent = true;
+            srand(11);
+            for (int i = 0; i < 100000; i++) {
+                uint64_t number = rand() % 5000;
+                if (rand() % 3 == 0) {
+                    consistent = consistent && set_remove_int(set, number) == present[number];
+                    present[number] = false;
+                } else {
+                    consistent = consistent && set_add_int(set, number) == !present[number];
+                    present[number] = true;
+                }
+            }
+
+            int expected_size = 0;
+            for (uint64_t number = 0; number < 5000; number++) {
+                consistent = consistent && set_contains_int(set, number) == present[number];
+                expected_size += present[number] ? 1 : 0;
+            }
+            should_bool(consistent) be truthy;
+            should_int(set_size(set)) be equal to(expected_size);
+            set_iterate_int(set, visit_number);
+            should_int(visited_count) be equal to(expected_size);
+        } end
+
+        it ("should combine sets of different sizes in any order") {
+            t_set *small = numbers_between(0, 3000, 3);
+            t_set *large = numbers_between(0, 3000, 2);
+            t_set *result;
+
+            result = set_union(small, large);
+            should_bool(contains_exactly_multiples(result, 3000, 2, 3, false)) be truthy;
+            set_destroy(result);
+            result = set_union(large, small);
+            should_bool(contains_exactly_multiples(result, 3000, 2, 3, false)) be truthy;
+            set_destroy(result);
+
+            result = set_intersection(small, large);
+            should_bool(contains_exactly_multiples(result, 3000, 2, 3, true)) be truthy;
+            set_destroy(result);
+            result = set_intersection(large, small);
+            should_bool(contains_exactly_multiples(result, 3000, 2, 3, true)) be truthy;
+            set_destroy(result);
+
+            result = set_difference(small, large);
+            should_int(set_size(result)) be equal to(500);
+            should_bool(set_contains_int(result, 3)) be truthy;
+            should_bool(set_contains_int(result, 6)) be falsey;
+            set_destroy(result);
+            result = set_difference(large, small);
+            should_int(set_size(result)) be equal to(1000);
+            should_bool(set_contains_int(result, 2)) be truthy;
+            should_bool(set_contains_int(result, 6)) be falsey;
+            should_bool(set_contains_int(result, 3004)) be falsey;
+            set_destroy(result);
+
+            set_destroy(small);
+            set_destroy(large);
+        } end
+
+        it ("should reserve, clean and be reused") {
+            set_reserve(set, 10000);
+            int table_max_size = set->table_max_size;
+            for (uint64_t number = 0; number < 10000; number++) {
+                set_add_int(set, number);
+            }
+            should_int(set->table_max_size) be equal to(table_max_size);
+
+            set_clean(set);
+            should_bool(set_is_empty(set)) be truthy;
+            should_bool(set_contains_int(set, 5)) be falsey;
+            set_add_int(set, 5);
+            should_bool(set_contains_int(set, 5)) be truthy;
+        } end
+
+    } end
+
+}
@@ -0,0 +1,196 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <commons/collections/skiplist.h>
+#include <cspecs/cspec.h>
+
+#define SKIPLIST_THREADS 4
+#define SKIPLIST_KEYS_PER_THREAD 5000
+#define SKIPLIST_STRESS_REMOVALS 50000
+#define SKIPLIST_MAX_RETIRED 1000
+
+static t_skiplist *shared_skiplist;
+static uint64_t last_visited_key;
+static int visited_count;
+static bool visited_in_order;
+static atomic_bool readers_running;
+
+static void visit(uint64_t key, void *element) {
+    visited_in_order = visited_in_order && (visited_count == 0 || last_visited_key < key)
+            && (uint64_t) (uintptr_t) element == key + 1;
+    last_visited_key = key;
+    visited_count++;
+}
+
+static void *insert_and_remove_range(void *first) {
+    // Agrega su rango de keys y luego quita las impares
+    uint64_t from = (uintptr_t) first;
+    for (uint64_t key = from; key < from + SKIPLIST_KEYS_PER_THREAD; key++) {
+        skiplist_insert(shared_skiplist, key, (void*) (uintptr_t) (key + 1));
+    }
+    for (uint64_t key = from + 1; key < from + SKIPLIST_KEYS_PER_THREAD; key += 2) {
+        skiplist_remove(shared_skiplist, key);
+    }
+    return NULL;
+}
+
+static void *find_preloaded_keys(void *_) {
+    // Las keys negativas de la lista precargada nunca se quitan
+    intptr_t missing = 0;
+    for (int round = 0; round < 20; round++) {
+        for (uint64_t key = 1; key <= 100; key++) {
+            if (skiplist_find(shared_skiplist, UINT64_MAX - key) == NULL) {
+                missing++;
+            }
+        }
+    }
+    return (void*) missing;
+}
+
+static void *find_until_stopped(void *_) {
+    // Busca sin pausas, por lo que siempre hay alguna operación en curso
+    intptr_t lookups = 0;
+    while (atomic_load(&readers_running)) {
+        skiplist_find(shared_skiplist, lookups++ % SKIPLIST_STRESS_REMOVALS);
+    }
+    return (void*) lookups;
+}
+
+static int retired_count(t_skiplist *skiplist) {
+    pthread_mutex_lock(&skiplist->retired_lock);
+    int count = skiplist->retired_count;
+    pthread_mutex_unlock(&skiplist->retired_lock);
+    return count;
+}
+
+context (test_skiplist) {
+
+    describe ("Skip list") {
+
+        t_skiplist *skiplist;
+
+        before {
+            skiplist = skiplist_create();
+            visited_count = 0;
+            visited_in_order = true;
+        } end
+
+        after {
+            skiplist_destroy(skiplist);
+        } end
+
+        it ("should be empty after creation") {
+            should_bool(skiplist_is_empty(skiplist)) be truthy;
+            should_ptr(skiplist_find(skiplist, 1)) be null;
+            should_ptr(skiplist_remove(skiplist, 1)) be null;
+            should_ptr(skiplist_ceil(skiplist, 0, NULL)) be null;
+        } end
+
+        it ("should insert, find and reject repeated keys") {
+            should_bool(skiplist_insert(skiplist, 20, (void*) 21)) be truthy;
+            should_bool(skiplist_insert(skiplist, 10, (void*) 11)) be truthy;
+            should_bool(skiplist_insert(skiplist, 20, (void*) 99)) be falsey;
+
+            should_int(skiplist_size(skiplist)) be equal to(2);
+            should_int((intptr_t) skiplist_find(skiplist, 20)) be equal to(21);
+            should_bool(skiplist_contains(skiplist, 10)) be truthy;
+            should_bool(skiplist_contains(skiplist, 15)) be falsey;
+        } end
+
+        it ("should remove elements and find the ceil") {
+            for (uint64_t key = 0; key < 1000; key += 10) {
+                skiplist_insert(skiplist, key, (void*) (uintptr_t) (key + 1));
+            }
+            uint64_t found;
+
+            should_int((intptr_t) skiplist_remove(skiplist, 500)) be equal to(501);
+            should_ptr(skiplist_remove(skiplist, 500)) be null;
+            should_int((intptr_t) skiplist_ceil(skiplist, 495, &found)) be equal to(511);
+            should_int(found) be equal to(510);
+            should_ptr(skiplist_ceil(skiplist, 991, NULL)) be null;
+            should_int(skiplist_size(skiplist)) be equal to(99);
+        } end
+
+        it ("should iterate in order") {
+            for (uint64_t key = 1000; key > 0; key--) {
+                skiplist_insert(skiplist, key * 7 % 1009, (void*) (uintptr_t) (key * 7 % 1009 + 1));
+            }
+            skiplist_iterate(skiplist, visit);
+            should_int(visited_count) be equal to(1000);
+            should_bool(visited_in_order) be truthy;
+        } end
+
+        it ("should keep readers working while several threads insert and remove") {
+            pthread_t writers[SKIPLIST_THREADS], readers[SKIPLIST_THREADS];
+            shared_skiplist = skiplist;
+            for (uint64_t key = 1; key <= 100; key++) {
+                skiplist_insert(skiplist, UINT64_MAX - key, (void*) (uintptr_t) (UINT64_MAX - key + 1));
+            }
+
+            for (intptr_t i = 0; i < SKIPLIST_THREADS; i++) {
+                pthread_create(&readers[i], NULL, find_preloaded_keys, NULL);
+                pthread_create(&writers[i], NULL, insert_and_remove_range, (void*) (i * SKIPLIST_KEYS_PER_THREAD));
+            }
+            intptr_t missing = 0;
+            for (int i = 0; i < SKIPLIST_THREADS; i++) {
+                void *thread_missing;
+                pthread_join(writers[i], NULL);
+                pthread_join(readers[i], &thread_missing);
+                missing += (intptr_t) thread_missing;
+            }
+
+            should_int(missing) be equal to(0);
+            should_int(skiplist_size(skiplist)) be equal to(SKIPLIST_THREADS * SKIPLIST_KEYS_PER_THREAD / 2 + 100);
+            skiplist_iterate(skiplist, visit);
+            should_int(visited_count) be equal to(SKIPLIST_THREADS * SKIPLIST_KEYS_PER_THREAD / 2 + 100);
+            should_bool(visited_in_order) be truthy;
+            should_bool(skiplist_contains(skiplist, 2)) be truthy;
+            should_bool(skiplist_contains(skiplist, 3)) be falsey;
+        } end
+
+        it ("should keep freeing removed nodes while readers never stop") {
+            pthread_t readers[SKIPLIST_THREADS];
+            shared_skiplist = skiplist;
+            for (uint64_t key = 0; key < SKIPLIST_STRESS_REMOVALS; key++) {
+                skiplist_insert(skiplist, key, (void*) (uintptr_t) (key + 1));
+            }
+
+            atomic_store(&readers_running, true);
+            for (int i = 0; i < SKIPLIST_THREADS; i++) {
+                pthread_create(&readers[i], NULL, find_until_stopped, NULL);
+            }
+            int max_retired = 0;
+            for (uint64_t key = 0; key < SKIPLIST_STRESS_REMOVALS; key++) {
+                skiplist_remove(skiplist, key);
+                int retired = retired_count(skiplist);
+                max_retired = retired > max_retired ? retired : max_retired;
+            }
+            atomic_store(&readers_running, false);
+            for (int i = 0; i < SKIPLIST_THREADS; i++) {
+                pthread_join(readers[i], NULL);
+            }
+
+            should_bool(skiplist_is_empty(skiplist)) be truthy;
+            should_bool(max_retired < SKIPLIST_MAX_RETIRED) be truthy;
+        } end
+
+    } end
+
+}
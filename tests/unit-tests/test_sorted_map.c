@@ -0,0 +1,198 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <commons/collections/sorted_map.h>
+#include <cspecs/cspec.h>
+
+#define SORTED_MAP_RANDOM_KEYS 20000
+
+static uint64_t visited_keys[SORTED_MAP_RANDOM_KEYS];
+static int visited_count;
+static bool visited_in_order;
+
+static int destroyed_count;
+
+static void count_destroyed(void *element) {
+    destroyed_count++;
+}
+
+static void visit(uint64_t key, void *element) {
+    visited_in_order = visited_in_order && (uint64_t) (uintptr_t) element == key * 10
+            && (visited_count == 0 || visited_keys[visited_count - 1] < key);
+    visited_keys[visited_count++] = key;
+}
+
+context (test_sorted_map) {
+
+    describe ("Sorted map") {
+
+        t_sorted_map *map;
+
+        before {
+            map = sorted_map_create();
+            visited_count = 0;
+            visited_in_order = true;
+        } end
+
+        after {
+            sorted_map_destroy(map);
+        } end
+
+        it ("should be empty after creation") {
+            should_bool(sorted_map_is_empty(map)) be truthy;
+            should_ptr(sorted_map_get(map, 1)) be null;
+            should_ptr(sorted_map_min(map, NULL)) be null;
+            should_ptr(sorted_map_max(map, NULL)) be null;
+            should_ptr(sorted_map_floor(map, 1, NULL)) be null;
+            should_ptr(sorted_map_ceil(map, 1, NULL)) be null;
+            should_ptr(sorted_map_remove_min(map, NULL)) be null;
+        } end
+
+        it ("should put, replace and get elements") {
+            sorted_map_put(map, 30, (void*) 300);
+            sorted_map_put(map, 10, (void*) 100);
+            sorted_map_put(map, 30, (void*) 301);
+
+            should_int(sorted_map_size(map)) be equal to(2);
+            should_int((intptr_t) sorted_map_get(map, 30)) be equal to(301);
+            should_int((intptr_t) sorted_map_get(map, 10)) be equal to(100);
+            should_bool(sorted_map_has_key(map, 20)) be falsey;
+        } end
+
+        it ("should destroy only the elements of removed keys, even if NULL") {
+            destroyed_count = 0;
+            sorted_map_put(map, 1, NULL);
+            sorted_map_put(map, 2, (void*) 20);
+
+            sorted_map_remove_and_destroy(map, 1, count_destroyed);
+            sorted_map_remove_and_destroy(map, 2, count_destroyed);
+            sorted_map_remove_and_destroy(map, 3, count_destroyed);
+
+            should_int(destroyed_count) be equal to(2);
+            should_bool(sorted_map_is_empty(map)) be truthy;
+        } end
+
+        it ("should find floor, ceil, min and max across many nodes") {
+            for (uint64_t key = 10; key <= 10000; key += 10) {
+                sorted_map_put(map, key, (void*) (uintptr_t) (key * 10));
+            }
+            uint64_t found;
+
+            should_int((intptr_t) sorted_map_floor(map, 4567, &found)) be equal to(45600);
+            should_int(found) be equal to(4560);
+            should_int((intptr_t) sorted_map_floor(map, 4560, &found)) be equal to(45600);
+            should_ptr(sorted_map_floor(map, 9, NULL)) be null;
+            should_int((intptr_t) sorted_map_ceil(map, 4561, &found)) be equal to(45700);
+            should_int(found) be equal to(4570);
+            should_ptr(sorted_map_ceil(map, 10001, NULL)) be null;
+
+            should_int((intptr_t) sorted_map_min(map, &found)) be equal to(100);
+            should_int(found) be equal to(10);
+            should_int((intptr_t) sorted_map_max(map, &found)) be equal to(100000);
+            should_int(found) be equal to(10000);
+        } end
+
+        it ("should iterate every key or a range in order") {
+            for (uint64_t key = 1000; key > 0; key--) {
+                sorted_map_put(map, key, (void*) (uintptr_t) (key * 10));
+            }
+
+            sorted_map_iterate(map, visit);
+            should_int(visited_count) be equal to(1000);
+            should_bool(visited_in_order) be truthy;
+
+            visited_count = 0;
+            sorted_map_iterate_range(map, 250, 749, visit);
+            should_int(visited_count) be equal to(500);
+            should_int(visited_keys[0]) be equal to(250);
+            should_int(visited_keys[499]) be equal to(749);
+            should_bool(visited_in_order) be truthy;
+
+            visited_count = 0;
+            sorted_map_iterate_range(map, 2000, 3000, visit);
+            should_int(visited_count) be equal to(0);
+        } end
+
+        it ("should remove elements in order from both ends") {
+            for (uint64_t key = 1; key <= 1000; key++) {
+                sorted_map_put(map, key, (void*) (uintptr_t) (key * 10));
+            }
+            uint64_t removed;
+
+            for (uint64_t key = 1; key <= 400; key++) {
+                should_int((intptr_t) sorted_map_remove_min(map, &removed)) be equal to(key * 10);
+                should_int(removed) be equal to(key);
+            }
+            for (uint64_t key = 1000; key > 600; key--) {
+                should_int((intptr_t) sorted_map_remove_max(map, &removed)) be equal to(key * 10);
+            }
+            should_int(sorted_map_size(map)) be equal to(200);
+
+            sorted_map_iterate(map, visit);
+            should_int(visited_keys[0]) be equal to(401);
+            should_int(visited_keys[199]) be equal to(600);
+            should_bool(visited_in_order) be truthy;
+        } end
+
+        it ("should keep every key reachable after random puts and removes") {
+            bool *present = calloc(SORTED_MAP_RANDOM_KEYS, sizeof(bool));
+            int expected_size = 0;
+            bool consistent = true;
+            srand(7);
+            for (int i = 0; i < 200000; i++) {
+                uint64_t key = 1 + rand() % (SORTED_MAP_RANDOM_KEYS - 1);
+                if (rand() % 3 == 0) {
+                    void *element = sorted_map_remove(map, key);
+                    consistent = consistent && present[key] == (element != NULL);
+                    expected_size -= present[key] ? 1 : 0;
+                    present[key] = false;
+                } else {
+                    sorted_map_put(map, key, (void*) (uintptr_t) (key * 10));
+                    expected_size += present[key] ? 0 : 1;
+                    present[key] = true;
+                }
+            }
+
+            should_bool(consistent) be truthy;
+            should_int(sorted_map_size(map)) be equal to(expected_size);
+            sorted_map_iterate(map, visit);
+            should_int(visited_count) be equal to(expected_size);
+            should_bool(visited_in_order) be truthy;
+
+            bool all_found = true;
+            for (uint64_t key = 1; key < SORTED_MAP_RANDOM_KEYS; key++) {
+                all_found = all_found && sorted_map_has_key(map, key) == present[key];
+            }
+            should_bool(all_found) be truthy;
+            free(present);
+        } end
+
+        it ("should clean and be reused") {
+            for (uint64_t key = 0; key < 500; key++) {
+                sorted_map_put(map, key, (void*) (uintptr_t) (key * 10));
+            }
+            sorted_map_clean(map);
+            should_bool(sorted_map_is_empty(map)) be truthy;
+
+            sorted_map_put(map, 7, (void*) 70);
+            should_int((intptr_t) sorted_map_get(map, 7)) be equal to(70);
+        } end
+
+    } end
+
+}
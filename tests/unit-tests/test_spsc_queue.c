@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <sched.h>
+#include <commons/collections/spsc_queue.h>
+#include <cspecs/cspec.h>
+
+#define STRESS_MESSAGES 200000
+
+static void *produce_in_order(void *queue) {
+    for (intptr_t i = 1; i <= STRESS_MESSAGES; i++) {
+        while (!spsc_queue_try_push(queue, (void*) i)) {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+context (test_spsc_queue) {
+
+    describe ("SPSC queue") {
+
+        t_spsc_queue *queue;
+
+        before {
+            queue = spsc_queue_create(4);
+        } end
+
+        after {
+            spsc_queue_destroy(queue);
+        } end
+
+        it ("should pop the elements in the order they were pushed") {
+            void *element;
+
+            should_bool(spsc_queue_try_push(queue, (void*) 1)) be truthy;
+            should_bool(spsc_queue_try_push(queue, (void*) 2)) be truthy;
+            should_int(spsc_queue_size(queue)) be equal to(2);
+
+            should_bool(spsc_queue_try_pop(queue, &element)) be truthy;
+            should_int((intptr_t) element) be equal to(1);
+            should_bool(spsc_queue_try_pop(queue, &element)) be truthy;
+            should_int((intptr_t) element) be equal to(2);
+            should_bool(spsc_queue_try_pop(queue, &element)) be falsey;
+            should_bool(spsc_queue_is_empty(queue)) be truthy;
+        } end
+
+        it ("should reject pushes when it is full") {
+            for (intptr_t i = 0; i < 4; i++) {
+                should_bool(spsc_queue_try_push(queue, (void*) i)) be truthy;
+            }
+
+            should_bool(spsc_queue_try_push(queue, (void*) 4)) be falsey;
+            should_int(spsc_queue_size(queue)) be equal to(4);
+        } end
+
+        it ("should ignore batches with a non positive count") {
+            void *elements[] = { (void*) 1, (void*) 2 };
+            void *popped[2] = { NULL, NULL };
+            spsc_queue_try_push(queue, (void*) 3);
+
+            should_int(spsc_queue_push_batch(queue, elements, -1)) be equal to(0);
+            should_int(spsc_queue_push_batch(queue, elements, 0)) be equal to(0);
+            should_int(spsc_queue_pop_batch(queue, popped, -1)) be equal to(0);
+            should_int(spsc_queue_pop_batch(queue, popped, 0)) be equal to(0);
+            should_ptr(popped[0]) be null;
+            should_int(spsc_queue_size(queue)) be equal to(1);
+        } end
+
+        it ("should push and pop in batches across the end of the buffer") {
+            void *elements[] = { (void*) 1, (void*) 2, (void*) 3, (void*) 4, (void*) 5 };
+            void *popped[5];
+
+            should_int(spsc_queue_push_batch(queue, elements, 3)) be equal to(3);
+            should_int(spsc_queue_pop_batch(queue, popped, 2)) be equal to(2);
+            should_int(spsc_queue_push_batch(queue, elements + 3, 2)) be equal to(2);
+            should_int(spsc_queue_push_batch(queue, elements, 5)) be equal to(1);
+
+            should_int(spsc_queue_pop_batch(queue, popped, 5)) be equal to(4);
+            should_int((intptr_t) popped[0]) be equal to(3);
+            should_int((intptr_t) popped[1]) be equal to(4);
+            should_int((intptr_t) popped[2]) be equal to(5);
+            should_int((intptr_t) popped[3]) be equal to(1);
+        } end
+
+        it ("should deliver every element in order between two threads") {
+            pthread_t producer;
+            pthread_create(&producer, NULL, produce_in_order, queue);
+
+            intptr_t expected = 1;
+            bool in_order = true;
+            void *popped[16];
+            while (expected <= STRESS_MESSAGES) {
+                int count = spsc_queue_pop_batch(queue, popped, 16);
+                if (count == 0) {
+                    sched_yield();
+                }
+                for (int i = 0; i < count; i++) {
+                    in_order = in_order && (intptr_t) popped[i] == expected;
+                    expected++;
+                }
+            }
+            pthread_join(producer, NULL);
+
+            should_bool(in_order) be truthy;
+            should_bool(spsc_queue_is_empty(queue)) be truthy;
+        } end
+
+    } end
+
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <commons/collections/stream.h>
+#include <cspecs/cspec.h>
+
+static int evaluated;
+
+static bool is_even(void *number) {
+    evaluated++;
+    return (intptr_t) number % 2 == 0;
+}
+
+static void *triple(void *number) {
+    return (void*) ((intptr_t) number * 3);
+}
+
+static void *sum(void *number1, void *number2) {
+    return (void*) ((intptr_t) number1 + (intptr_t) number2);
+}
+
+context (test_stream) {
+
+    describe ("Stream") {
+
+        t_list *numbers;
+
+        before {
+            evaluated = 0;
+            numbers = list_create();
+            for (intptr_t i = 0; i < 100; i++) {
+                list_add(numbers, (void*) i);
+            }
+        } end
+
+        after {
+            list_destroy(numbers);
+        } end
+
+        it ("should collect the same elements as the original list without stages") {
+            t_list *collected = stream_collect(stream_of(numbers));
+
+            should_int(list_size(collected)) be equal to(100);
+            should_int((intptr_t) list_get(collected, 42)) be equal to(42);
+            list_destroy(collected);
+        } end
+
+        it ("should apply the stages in order") {
+            t_stream *stream = stream_of(numbers);
+            stream = stream_filter(stream, is_even);
+            stream = stream_map(stream, triple);
+            t_list *collected = stream_collect(stream);
+
+            should_int(list_size(collected)) be equal to(50);
+            should_int((intptr_t) list_get(collected, 0)) be equal to(0);
+            should_int((intptr_t) list_get(collected, 1)) be equal to(6);
+            should_int((intptr_t) list_get(collected, 49)) be equal to(294);
+            list_destroy(collected);
+        } end
+
+        it ("should stop evaluating the list once take is satisfied") {
+            t_stream *stream = stream_filter(stream_of(numbers), is_even);
+            t_list *collected = stream_collect(stream_take(stream, 3));
+
+            should_int(list_size(collected)) be equal to(3);
+            should_int((intptr_t) list_get(collected, 2)) be equal to(4);
+            should_int(evaluated) be equal to(5);
+            list_destroy(collected);
+        } end
+
+        it ("should count in take only the elements that reach it") {
+            t_stream *stream = stream_take(stream_of(numbers), 10);
+            stream = stream_filter(stream, is_even);
+            t_list *collected = stream_collect(stream);
+
+            should_int(list_size(collected)) be equal to(5);
+            should_int(evaluated) be equal to(10);
+            list_destroy(collected);
+        } end
+
+        it ("should not evaluate anything with take 0") {
+            t_stream *stream = stream_filter(stream_of(numbers), is_even);
+            t_list *collected = stream_collect(stream_take(stream, 0));
+
+            should_bool(list_is_empty(collected)) be truthy;
+            should_int(evaluated) be equal to(0);
+            list_destroy(collected);
+        } end
+
+        it ("should fold the resulting elements") {
+            t_stream *stream = stream_map(stream_filter(stream_of(numbers), is_even), triple);
+            should_int((intptr_t) stream_fold(stream, (void*) 1, sum)) be equal to(1 + 3 * 2450);
+        } end
+
+        it ("should fold to the seed when no element passes") {
+            t_stream *stream = stream_take(stream_of(numbers), 0);
+            should_int((intptr_t) stream_fold(stream, (void*) 7, sum)) be equal to(7);
+        } end
+
+        it ("should be destroyable without running it") {
+            stream_destroy(stream_filter(stream_of(numbers), is_even));
+            should_int(evaluated) be equal to(0);
+        } end
+
+    } end
+
+}
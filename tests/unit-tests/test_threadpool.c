@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <unistd.h>
+#include <commons/threadpool.h>
+#include <cspecs/cspec.h>
+
+#define SUBMITTERS 4
+#define TASKS_PER_SUBMITTER 1000
+
+static t_threadpool *shared_pool;
+
+static void *square(void *number) {
+    return (void*) ((intptr_t) number * (intptr_t) number);
+}
+
+static void *fibonacci(void *number) {
+    intptr_t n = (intptr_t) number;
+    if (n < 2) {
+        return (void*) n;
+    }
+    t_future *previous = threadpool_submit(shared_pool, fibonacci, (void*) (n - 1));
+    intptr_t before_previous = (intptr_t) fibonacci((void*) (n - 2));
+    return (void*) ((intptr_t) threadpool_join(shared_pool, previous) + before_previous);
+}
+
+static void *submit_and_sum_squares(void *_) {
+    t_future *futures[TASKS_PER_SUBMITTER];
+    for (intptr_t i = 0; i < TASKS_PER_SUBMITTER; i++) {
+        futures[i] = threadpool_submit(shared_pool, square, (void*) i);
+    }
+    intptr_t sum = 0;
+    for (int i = 0; i < TASKS_PER_SUBMITTER; i++) {
+        sum += (intptr_t) threadpool_join(shared_pool, futures[i]);
+    }
+    return (void*) sum;
+}
+
+static atomic_bool slow_task_started;
+
+static void *slow_square(void *number) {
+    atomic_store(&slow_task_started, true);
+    usleep(200000);
+    return square(number);
+}
+
+static void *join_stolen_task(void *_) {
+    // Espera a que otro hilo robe la tarea y mide cuánta CPU usa mientras
+    // la espera sin tener otras tareas para ejecutar
+    atomic_store(&slow_task_started, false);
+    t_future *future = threadpool_submit(shared_pool, slow_square, (void*) 6);
+    while (!atomic_load(&slow_task_started)) {
+        sched_yield();
+    }
+
+    struct timespec before_join, after_join;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &before_join);
+    intptr_t result = (intptr_t) threadpool_join(shared_pool, future);
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &after_join);
+    int64_t cpu_ms = (after_join.tv_sec - before_join.tv_sec) * 1000 + (after_join.tv_nsec - before_join.tv_nsec) / 1000000;
+    return (void*) (result == 36 && cpu_ms < 50);
+}
+
+context (test_threadpool) {
+
+    describe ("Thread pool") {
+
+        t_threadpool *pool;
+
+        before {
+            pool = threadpool_create(4);
+            shared_pool = pool;
+        } end
+
+        after {
+            threadpool_destroy(pool);
+        } end
+
+        it ("should create as many threads as requested") {
+            should_int(threadpool_size(pool)) be equal to(4);
+        } end
+
+        it ("should return the result of a task when joining it") {
+            t_future *future = threadpool_submit(pool, square, (void*) 12);
+            should_int((intptr_t) threadpool_join(pool, future)) be equal to(144);
+        } end
+
+        it ("should run every submitted task") {
+            t_future *futures[1000];
+            for (intptr_t i = 0; i < 1000; i++) {
+                futures[i] = threadpool_submit(pool, square, (void*) i);
+            }
+
+            intptr_t sum = 0;
+            for (int i = 0; i < 1000; i++) {
+                sum += (intptr_t) threadpool_join(pool, futures[i]);
+            }
+            should_int(sum) be equal to(332833500);
+        } end
+
+        it ("should mark a future as done once its task finished") {
+            t_future *future = threadpool_submit(pool, square, (void*) 3);
+            while (!threadpool_future_is_done(future));
+            should_int((intptr_t) threadpool_join(pool, future)) be equal to(9);
+        } end
+
+        it ("should let tasks submit and join other tasks") {
+            t_future *future = threadpool_submit(pool, fibonacci, (void*) 20);
+            should_int((intptr_t) threadpool_join(pool, future)) be equal to(6765);
+        } end
+
+        it ("should accept tasks from several threads at once") {
+            pthread_t submitters[SUBMITTERS];
+            for (int i = 0; i < SUBMITTERS; i++) {
+                pthread_create(&submitters[i], NULL, submit_and_sum_squares, NULL);
+            }
+
+            for (int i = 0; i < SUBMITTERS; i++) {
+                void *sum;
+                pthread_join(submitters[i], &sum);
+                should_int((intptr_t) sum) be equal to(332833500);
+            }
+        } end
+
+        it ("should sleep instead of spinning while a stolen task runs") {
+            t_future *future = threadpool_submit(pool, join_stolen_task, NULL);
+            should_bool((intptr_t) threadpool_join(pool, future)) be truthy;
+        } end
+
+        it ("should run tasks in a pool pinned to the CPUs") {
+            t_threadpool *pinned = threadpool_create_pinned(0);
+            should_bool(threadpool_size(pinned) >= 1) be truthy;
+
+            t_future *future = threadpool_submit(pinned, square, (void*) 7);
+            should_int((intptr_t) threadpool_join(pinned, future)) be equal to(49);
+            threadpool_destroy(pinned);
+        } end
+
+        it ("should pin the workers only to the CPUs the process is allowed to use") {
+            // Se restringe el hilo que crea el pool a la última CPU permitida
+            cpu_set_t original, restricted;
+            sched_getaffinity(0, sizeof(cpu_set_t), &original);
+            int last_cpu = 0;
+            for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+                last_cpu = CPU_ISSET(cpu, &original) ? cpu : last_cpu;
+            }
+            CPU_ZERO(&restricted);
+            CPU_SET(last_cpu, &restricted);
+            sched_setaffinity(0, sizeof(cpu_set_t), &restricted);
+
+            t_threadpool *pinned = threadpool_create_pinned(3);
+            sched_setaffinity(0, sizeof(cpu_set_t), &original);
+
+            bool all_pinned = true;
+            for (int i = 0; i < threadpool_size(pinned); i++) {
+                cpu_set_t worker_cpus;
+                pthread_getaffinity_np(pinned->workers[i].thread, sizeof(cpu_set_t), &worker_cpus);
+                all_pinned = all_pinned && CPU_EQUAL(&worker_cpus, &restricted);
+            }
+            should_int(threadpool_size(pinned)) be equal to(3);
+            should_bool(all_pinned) be truthy;
+
+            t_future *future = threadpool_submit(pinned, square, (void*) 9);
+            should_int((intptr_t) threadpool_join(pinned, future)) be equal to(81);
+            threadpool_destroy(pinned);
+        } end
+
+    } end
+
+}
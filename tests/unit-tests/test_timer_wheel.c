@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <commons/timer_wheel.h>
+#include <commons/collections/list.h>
+#include <cspecs/cspec.h>
+
+static t_timer_wheel *wheel;
+static t_list *fired;
+static t_list *fired_at;
+
+static void record_expiration(void *data) {
+    list_add(fired, data);
+    list_add(fired_at, (void*) (intptr_t) timer_wheel_get_time(wheel));
+}
+
+static void reschedule_once(void *data) {
+    record_expiration(data);
+    if ((intptr_t) data == 1) {
+        timer_wheel_schedule(wheel, 5, record_expiration, (void*) 2);
+    }
+}
+
+context (test_timer_wheel) {
+
+    describe ("Timer wheel") {
+
+        before {
+            wheel = timer_wheel_create();
+            fired = list_create();
+            fired_at = list_create();
+        } end
+
+        after {
+            timer_wheel_destroy(wheel);
+            list_destroy(fired);
+            list_destroy(fired_at);
+        } end
+
+        it ("should expire a timer once its delay has elapsed") {
+            timer_wheel_schedule(wheel, 10, record_expiration, (void*) 1);
+            should_int(timer_wheel_size(wheel)) be equal to(1);
+
+            should_int(timer_wheel_advance_to(wheel, 9)) be equal to(0);
+            should_int(timer_wheel_advance_to(wheel, 10)) be equal to(1);
+            should_int(timer_wheel_size(wheel)) be equal to(0);
+            should_int((intptr_t) list_get(fired_at, 0)) be equal to(10);
+        } end
+
+        it ("should expire the timers in order of expiration") {
+            timer_wheel_schedule(wheel, 300, record_expiration, (void*) 3);
+            timer_wheel_schedule(wheel, 20, record_expiration, (void*) 1);
+            timer_wheel_schedule(wheel, 70000, record_expiration, (void*) 4);
+            timer_wheel_schedule(wheel, 255, record_expiration, (void*) 2);
+
+            should_int(timer_wheel_advance_to(wheel, 100000)) be equal to(4);
+            for (int i = 0; i < 4; i++) {
+                should_int((intptr_t) list_get(fired, i)) be equal to(i + 1);
+            }
+            should_int((intptr_t) list_get(fired_at, 0)) be equal to(20);
+            should_int((intptr_t) list_get(fired_at, 1)) be equal to(255);
+            should_int((intptr_t) list_get(fired_at, 2)) be equal to(300);
+            should_int((intptr_t) list_get(fired_at, 3)) be equal to(70000);
+        } end
+
+        it ("should expire each timer at its exact tick after being redistributed") {
+            for (intptr_t delay = 1; delay <= 200000; delay = delay * 3 + 7) {
+                timer_wheel_schedule(wheel, delay, record_expiration, (void*) delay);
+            }
+            int scheduled = timer_wheel_size(wheel);
+
+            for (int64_t time = 0; time <= 200000; time += 997) {
+                timer_wheel_advance_to(wheel, time);
+            }
+            timer_wheel_advance_to(wheel, 200000);
+
+            should_int(list_size(fired)) be equal to(scheduled);
+            for (int i = 0; i < list_size(fired); i++) {
+                should_int((intptr_t) list_get(fired_at, i)) be equal to((intptr_t) list_get(fired, i));
+            }
+        } end
+
+        it ("should count the delay from the last advance") {
+            timer_wheel_advance_to(wheel, 1000);
+            timer_wheel_schedule(wheel, 10, record_expiration, (void*) 1);
+
+            should_int(timer_wheel_advance_to(wheel, 1009)) be equal to(0);
+            should_int(timer_wheel_advance_to(wheel, 1010)) be equal to(1);
+        } end
+
+        it ("should expire a timer without delay in the next advance") {
+            timer_wheel_schedule(wheel, 0, record_expiration, (void*) 1);
+            should_int(timer_wheel_advance_to(wheel, 1)) be equal to(1);
+        } end
+
+        it ("should expire timers further than the wheel range") {
+            int64_t delay = (INT64_C(1) << 32) + 5;
+            timer_wheel_schedule(wheel, delay, record_expiration, (void*) 1);
+
+            should_int(timer_wheel_advance_to(wheel, delay - 1)) be equal to(0);
+            should_int(timer_wheel_advance_to(wheel, delay)) be equal to(1);
+        } end
+
+        it ("should not run the callback of a cancelled timer") {
+            t_timer *cancelled = timer_wheel_schedule(wheel, 50, record_expiration, (void*) 1);
+            timer_wheel_schedule(wheel, 50, record_expiration, (void*) 2);
+
+            timer_wheel_cancel(wheel, cancelled);
+            should_int(timer_wheel_size(wheel)) be equal to(1);
+
+            should_int(timer_wheel_advance_to(wheel, 50)) be equal to(1);
+            should_int((intptr_t) list_get(fired, 0)) be equal to(2);
+        } end
+
+        it ("should let a callback schedule new timers") {
+            timer_wheel_schedule(wheel, 10, reschedule_once, (void*) 1);
+
+            should_int(timer_wheel_advance_to(wheel, 14)) be equal to(1);
+            should_int(timer_wheel_advance_to(wheel, 15)) be equal to(1);
+            should_int((intptr_t) list_get(fired, 1)) be equal to(2);
+        } end
+
+        it ("should advance with its own clock") {
+            timer_wheel_schedule(wheel, 2, record_expiration, (void*) 1);
+            usleep(10000);
+
+            should_int(timer_wheel_advance(wheel)) be equal to(1);
+            should_bool(timer_wheel_get_time(wheel) >= 10) be truthy;
+        } end
+
+        it ("should destroy the data of the pending timers") {
+            timer_wheel_schedule(wheel, 10, record_expiration, malloc(sizeof(int)));
+            timer_wheel_schedule(wheel, 100000, record_expiration, malloc(sizeof(int)));
+
+            t_timer_wheel *destroyed = wheel;
+            wheel = timer_wheel_create();
+            timer_wheel_destroy_and_destroy_elements(destroyed, free);
+        } end
+
+    } end
+
+}
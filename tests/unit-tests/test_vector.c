@@ -0,0 +1,372 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <commons/collections/vector.h>
+#include <commons/string.h>
+#include <cspecs/cspec.h>
+
+typedef struct {
+    char *name;
+    unsigned char age;
+} t_person;
+
+static t_person *persona_create(char *name, unsigned char age) {
+    t_person *new = malloc(sizeof(t_person));
+    new->name = strdup(name);
+    new->age = age;
+    return new;
+}
+
+static void persona_destroy(t_person *self) {
+    free(self->name);
+    free(self);
+}
+
+static bool _ayudantes_menor(t_person *joven, t_person *menos_joven) {
+    return joven->age <= menos_joven->age;
+}
+
+static void* _ayudantes_minimo_edad(t_person* person1, t_person* person2) {
+    return person1->age <= person2->age ? person1 : person2;
+}
+
+context (test_vector) {
+
+    void assert_person(t_person *person, char* name, int age) {
+        should_ptr(person) not be null;
+        should_string(person->name) be equal to(name);
+        should_int(person->age) be equal to(age);
+    }
+
+    void assert_person_in_vector(t_vector *vector, int index, char* name, int age) {
+        assert_person(vector_get(vector, index), name, age);
+    }
+
+    describe ("Vector") {
+
+        t_vector *vector;
+
+        before {
+            vector = vector_create();
+        } end
+
+        after {
+            vector_destroy_and_destroy_elements(vector, (void*) persona_destroy);
+        } end
+
+        describe ("Add") {
+
+            it ("should add a value") {
+                should_int(vector_add(vector, persona_create("Matias", 24))) be equal to(0);
+                should_int(vector_add(vector, persona_create("Gaston", 25))) be equal to(1);
+
+                should_int(vector_size(vector)) be equal to(2);
+                assert_person_in_vector(vector, 0, "Matias", 24);
+                assert_person_in_vector(vector, 1, "Gaston", 25);
+            } end
+
+            it ("should add a value at index") {
+                vector_add(vector, persona_create("Matias", 24));
+                vector_add(vector, persona_create("Gaston", 25));
+
+                vector_add_in_index(vector, 1, persona_create("Sebastian", 21));
+                vector_add_in_index(vector, 0, persona_create("Daniela", 19));
+
+                should_int(vector_size(vector)) be equal to(4);
+                assert_person_in_vector(vector, 0, "Daniela"  , 19);
+                assert_person_in_vector(vector, 1, "Matias"   , 24);
+                assert_person_in_vector(vector, 2, "Sebastian", 21);
+                assert_person_in_vector(vector, 3, "Gaston"   , 25);
+            } end
+
+            it ("should add values in a sorted vector") {
+                vector_add(vector, persona_create("Sebastian", 21));
+                vector_add(vector, persona_create("Matias"   , 24));
+
+                should_int(vector_add_sorted(vector, persona_create("Daniela", 19), (void*) _ayudantes_menor)) be equal to(0);
+                should_int(vector_add_sorted(vector, persona_create("Agustin", 22), (void*) _ayudantes_menor)) be equal to(2);
+                should_int(vector_add_sorted(vector, persona_create("Gaston" , 24), (void*) _ayudantes_menor)) be equal to(4);
+
+                should_int(vector_size(vector)) be equal to(5);
+                assert_person_in_vector(vector, 0, "Daniela"  , 19);
+                assert_person_in_vector(vector, 1, "Sebastian", 21);
+                assert_person_in_vector(vector, 2, "Agustin"  , 22);
+                assert_person_in_vector(vector, 3, "Matias"   , 24);
+                assert_person_in_vector(vector, 4, "Gaston"   , 24);
+            } end
+
+            it ("should add all vector into other vector") {
+                vector_add(vector, persona_create("Matias", 24));
+
+                t_vector* other = vector_create();
+                vector_add(other, persona_create("Daniela", 19));
+                vector_add(other, persona_create("Facundo", 25));
+
+                vector_add_all(vector, other);
+
+                should_int(vector_size(vector)) be equal to(3);
+                assert_person_in_vector(vector, 1, "Daniela", 19);
+                assert_person_in_vector(vector, 2, "Facundo", 25);
+                should_ptr(vector_get(other, 0)) be equal to(vector_get(vector, 1));
+
+                vector_destroy(other);
+            } end
+
+            it ("should grow beyond its initial capacity") {
+                for (int i = 0; i < 100; i++) {
+                    vector_add(vector, persona_create("Matias", i));
+                }
+
+                should_int(vector_size(vector)) be equal to(100);
+                should_bool(vector->capacity >= 100) be truthy;
+                for (int i = 0; i < 100; i++) {
+                    assert_person_in_vector(vector, i, "Matias", i);
+                }
+            } end
+
+        } end
+
+        describe ("Capacity") {
+
+            it ("should reserve capacity without adding elements") {
+                vector_reserve(vector, 50);
+
+                should_int(vector->capacity) be equal to(50);
+                should_bool(vector_is_empty(vector)) be truthy;
+            } end
+
+            it ("should not shrink when reserving less than its capacity") {
+                vector_reserve(vector, 50);
+                vector_reserve(vector, 10);
+
+                should_int(vector->capacity) be equal to(50);
+            } end
+
+            it ("should shrink to fit its elements") {
+                vector_reserve(vector, 50);
+                vector_add(vector, persona_create("Matias", 24));
+                vector_add(vector, persona_create("Gaston", 25));
+
+                vector_shrink_to_fit(vector);
+
+                should_int(vector->capacity) be equal to(2);
+                assert_person_in_vector(vector, 0, "Matias", 24);
+                assert_person_in_vector(vector, 1, "Gaston", 25);
+            } end
+
+        } end
+
+        describe ("Replace, remove and destroy") {
+
+            before {
+                vector_add(vector, persona_create("Matias"   , 24));
+                vector_add(vector, persona_create("Gaston"   , 25));
+                vector_add(vector, persona_create("Sebastian", 21));
+                vector_add(vector, persona_create("Daniela"  , 19));
+            } end
+
+            it ("should replace a value at index") {
+                t_person* gaston = vector_replace(vector, 1, persona_create("Facundo", 25));
+
+                assert_person(gaston, "Gaston", 25);
+                assert_person_in_vector(vector, 1, "Facundo", 25);
+                should_int(vector_size(vector)) be equal to(4);
+
+                persona_destroy(gaston);
+            } end
+
+            it ("should remove a value at index") {
+                t_person* gaston = vector_remove(vector, 1);
+
+                assert_person(gaston, "Gaston", 25);
+                should_int(vector_size(vector)) be equal to(3);
+                assert_person_in_vector(vector, 0, "Matias"   , 24);
+                assert_person_in_vector(vector, 1, "Sebastian", 21);
+                assert_person_in_vector(vector, 2, "Daniela"  , 19);
+
+                persona_destroy(gaston);
+            } end
+
+            it ("should remove an element from its pointer") {
+                t_person* sebastian = vector_get(vector, 2);
+
+                should_bool(vector_remove_element(vector, sebastian)) be truthy;
+                should_bool(vector_remove_element(vector, sebastian)) be falsey;
+                should_int(vector_size(vector)) be equal to(3);
+
+                persona_destroy(sebastian);
+            } end
+
+            it ("should remove and destroy all values which satisfy a condition") {
+                bool _is_older_than_21(t_person* person) {
+                    return person->age > 21;
+                }
+                vector_remove_and_destroy_all_by_condition(vector, (void*) _is_older_than_21, (void*) persona_destroy);
+
+                should_int(vector_size(vector)) be equal to(2);
+                assert_person_in_vector(vector, 0, "Sebastian", 21);
+                assert_person_in_vector(vector, 1, "Daniela"  , 19);
+            } end
+
+            it ("should slice and remove elements") {
+                t_vector* sub = vector_slice_and_remove(vector, 1, 10);
+
+                should_int(vector_size(sub)) be equal to(3);
+                assert_person_in_vector(sub, 0, "Gaston"   , 25);
+                assert_person_in_vector(sub, 2, "Daniela"  , 19);
+
+                should_int(vector_size(vector)) be equal to(1);
+                assert_person_in_vector(vector, 0, "Matias", 24);
+
+                vector_destroy_and_destroy_elements(sub, (void*) persona_destroy);
+            } end
+
+            it ("should not remove anything when slicing out of range") {
+                t_vector* after_end = vector_slice_and_remove(vector, 10, 2);
+                should_int(vector_size(after_end)) be equal to(0);
+                should_int(vector_size(vector)) be equal to(4);
+                vector_destroy(after_end);
+
+                t_vector* before_start = vector_slice_and_remove(vector, -5, 2);
+                should_int(vector_size(before_start)) be equal to(0);
+                should_int(vector_size(vector)) be equal to(4);
+                vector_destroy(before_start);
+
+                t_vector* overlapping = vector_slice_and_remove(vector, -1, 2);
+                should_int(vector_size(overlapping)) be equal to(1);
+                assert_person_in_vector(overlapping, 0, "Matias", 24);
+                should_int(vector_size(vector)) be equal to(3);
+                assert_person_in_vector(vector, 0, "Gaston", 25);
+                vector_destroy_and_destroy_elements(overlapping, (void*) persona_destroy);
+            } end
+
+        } end
+
+        describe ("Higher order functions") {
+
+            before {
+                vector_add(vector, persona_create("Matias"   , 24));
+                vector_add(vector, persona_create("Gaston"   , 25));
+                vector_add(vector, persona_create("Sebastian", 21));
+                vector_add(vector, persona_create("Ezequiel" , 25));
+                vector_add(vector, persona_create("Daniela"  , 19));
+            } end
+
+            it ("should filter the values that satisfy a condition") {
+                bool _is_25(t_person* person) {
+                    return person->age == 25;
+                }
+                t_vector* filtered = vector_filter(vector, (void*) _is_25);
+
+                should_int(vector_size(filtered)) be equal to(2);
+                assert_person_in_vector(filtered, 0, "Gaston"  , 25);
+                assert_person_in_vector(filtered, 1, "Ezequiel", 25);
+
+                vector_destroy(filtered);
+            } end
+
+            it ("should map a vector with the function result") {
+                char* _get_name(t_person* person) {
+                    return person->name;
+                }
+                t_vector* names = vector_map(vector, (void*) _get_name);
+
+                should_int(vector_size(names)) be equal to(5);
+                should_string(vector_get(names, 0)) be equal to("Matias");
+                should_string(vector_get(names, 4)) be equal to("Daniela");
+
+                vector_destroy(names);
+            } end
+
+            it ("should fold all values into a single one") {
+                void* _sum_ages(int acc, t_person* person) {
+                    return (void*) (long) (acc + person->age);
+                }
+                int sum = (int) (long) vector_fold(vector, 0, (void*) _sum_ages);
+
+                should_int(sum) be equal to(24 + 25 + 21 + 25 + 19);
+                assert_person(vector_get_minimum(vector, (void*) _ayudantes_minimo_edad), "Daniela", 19);
+            } end
+
+            it ("should sort a vector keeping the order of duplicated values") {
+                vector_sort(vector, (void*) _ayudantes_menor);
+
+                assert_person_in_vector(vector, 0, "Daniela"  , 19);
+                assert_person_in_vector(vector, 1, "Sebastian", 21);
+                assert_person_in_vector(vector, 2, "Matias"   , 24);
+                assert_person_in_vector(vector, 3, "Gaston"   , 25);
+                assert_person_in_vector(vector, 4, "Ezequiel" , 25);
+            } end
+
+            it ("should return a sorted vector without side effect") {
+                t_vector* sorted = vector_sorted(vector, (void*) _ayudantes_menor);
+
+                assert_person_in_vector(sorted, 0, "Daniela", 19);
+                assert_person_in_vector(vector, 0, "Matias" , 24);
+
+                vector_destroy(sorted);
+            } end
+
+        } end
+
+    } end
+
+    describe ("Vector iterator") {
+        t_vector *vector;
+        t_vector_iterator* iterator;
+
+        before {
+            vector = vector_create();
+            vector_add(vector, persona_create("Matias"   , 24));
+            vector_add(vector, persona_create("Gaston"   , 25));
+            vector_add(vector, persona_create("Sebastian", 21));
+            iterator = vector_iterator_create(vector);
+        } end
+
+        after {
+            vector_iterator_destroy(iterator);
+            vector_destroy_and_destroy_elements(vector, (void*) persona_destroy);
+        } end
+
+        it ("should add and remove elements while iterating") {
+            char *names[] = { "Matias", "Gaston", "Sebastian" };
+            int i = 0;
+
+            while (vector_iterator_has_next(iterator)) {
+                t_person* person = vector_iterator_next(iterator);
+                should_string(person->name) be equal to (names[i++]);
+
+                if (string_equals_ignore_case(person->name, "Gaston")) {
+                    vector_iterator_remove(iterator);
+                    persona_destroy(person);
+                } else {
+                    vector_iterator_add(iterator, persona_create("Agustin", 23));
+                }
+            }
+
+            should_int(vector_size(vector)) be equal to (4);
+            assert_person_in_vector(vector, 0, "Matias"   , 24);
+            assert_person_in_vector(vector, 1, "Agustin"  , 23);
+            assert_person_in_vector(vector, 2, "Sebastian", 21);
+            assert_person_in_vector(vector, 3, "Agustin"  , 23);
+        } end
+
+    } end
+
+}
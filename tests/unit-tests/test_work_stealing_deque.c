@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2012 Sistemas Operativos - UTN FRBA. All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <commons/collections/work_stealing_deque.h>
+#include <cspecs/cspec.h>
+
+#define THIEVES 3
+#define DEQUE_ELEMENTS 100000
+
+static t_work_stealing_deque *shared_deque;
+static atomic_bool owner_finished;
+
+static void *steal_and_sum(void *_) {
+    intptr_t sum = 0;
+    void *element;
+    while (!atomic_load(&owner_finished) || work_stealing_deque_size(shared_deque) > 0) {
+        if (work_stealing_deque_steal(shared_deque, &element)) {
+            sum += (intptr_t) element;
+        }
+    }
+    return (void*) sum;
+}
+
+context (test_work_stealing_deque) {
+
+    describe ("Work stealing deque") {
+
+        t_work_stealing_deque *deque;
+
+        before {
+            deque = work_stealing_deque_create(4);
+        } end
+
+        after {
+            work_stealing_deque_destroy(deque);
+        } end
+
+        it ("should pop the last pushed element first") {
+            void *element;
+            work_stealing_deque_push(deque, (void*) 1);
+            work_stealing_deque_push(deque, (void*) 2);
+
+            should_bool(work_stealing_deque_pop(deque, &element)) be truthy;
+            should_int((intptr_t) element) be equal to(2);
+            should_bool(work_stealing_deque_pop(deque, &element)) be truthy;
+            should_int((intptr_t) element) be equal to(1);
+            should_bool(work_stealing_deque_pop(deque, &element)) be falsey;
+        } end
+
+        it ("should steal the first pushed element first") {
+            void *element;
+            work_stealing_deque_push(deque, (void*) 1);
+            work_stealing_deque_push(deque, (void*) 2);
+
+            should_bool(work_stealing_deque_steal(deque, &element)) be truthy;
+            should_int((intptr_t) element) be equal to(1);
+            should_int(work_stealing_deque_size(deque)) be equal to(1);
+            should_bool(work_stealing_deque_pop(deque, &element)) be truthy;
+            should_int((intptr_t) element) be equal to(2);
+            should_bool(work_stealing_deque_steal(deque, &element)) be falsey;
+        } end
+
+        it ("should grow when it is full keeping the order") {
+            void *element;
+            for (intptr_t i = 0; i < 100; i++) {
+                work_stealing_deque_push(deque, (void*) i);
+            }
+            should_int(work_stealing_deque_size(deque)) be equal to(100);
+
+            should_bool(work_stealing_deque_steal(deque, &element)) be truthy;
+            should_int((intptr_t) element) be equal to(0);
+            for (intptr_t i = 99; i > 0; i--) {
+                should_bool(work_stealing_deque_pop(deque, &element)) be truthy;
+                should_int((intptr_t) element) be equal to(i);
+            }
+        } end
+
+        it ("should deliver every element once with thieves running") {
+            pthread_t thieves[THIEVES];
+            shared_deque = deque;
+            atomic_store(&owner_finished, false);
+            for (int i = 0; i < THIEVES; i++) {
+                pthread_create(&thieves[i], NULL, steal_and_sum, NULL);
+            }
+
+            intptr_t sum = 0;
+            void *element;
+            for (intptr_t i = 1; i <= DEQUE_ELEMENTS; i++) {
+                work_stealing_deque_push(deque, (void*) i);
+                if (i % 3 == 0 && work_stealing_deque_pop(deque, &element)) {
+                    sum += (intptr_t) element;
+                }
+            }
+            while (work_stealing_deque_pop(deque, &element)) {
+                sum += (intptr_t) element;
+            }
+            atomic_store(&owner_finished, true);
+
+            for (int i = 0; i < THIEVES; i++) {
+                void *stolen_sum;
+                pthread_join(thieves[i], &stolen_sum);
+                sum += (intptr_t) stolen_sum;
+            }
+            should_int(sum) be equal to((intptr_t) DEQUE_ELEMENTS * (DEQUE_ELEMENTS + 1) / 2);
+        } end
+
+    } end
+
+}